@@ -0,0 +1,85 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <enchantum/batch.hpp>
+#include <enchantum/enchantum.hpp>
+#include <string>
+#include <vector>
+
+namespace {
+enum class Country {
+  Argentina,
+  Australia,
+  Austria,
+  Belgium,
+  Brazil,
+  Canada,
+  Chile,
+  China,
+  Denmark,
+  Egypt,
+  Finland,
+  France,
+  Germany,
+  Greece,
+  India,
+  Ireland,
+  Italy,
+  Japan,
+  Mexico,
+  Netherlands,
+  Norway,
+  Poland,
+  Portugal,
+  Spain,
+  Sweden,
+  Switzerland,
+  Turkey,
+  Ukraine,
+  UnitedKingdom,
+  UnitedStates,
+  Uruguay,
+  Vietnam,
+};
+
+// a column sorted by a different key so equal values come in short runs
+std::vector<std::string> make_column(const std::size_t run)
+{
+  std::vector<std::string> column;
+  for (std::size_t i = 0; column.size() < (1 << 18); ++i) {
+    const auto name = enchantum::names<Country>[i * 7 % enchantum::count<Country>];
+    for (std::size_t j = 0; j < run; ++j)
+      column.emplace_back(name);
+  }
+  return column;
+}
+
+void bench_batch(const char* const label, const std::size_t run)
+{
+  const auto                    storage = make_column(run);
+  std::vector<std::string_view> column(storage.begin(), storage.end());
+  std::vector<Country>          values(column.size());
+  std::vector<std::uint8_t>     validity((column.size() + 7) / 8);
+
+  BENCHMARK(std::string(label) + " cast per row")
+  {
+    std::size_t valid = 0;
+    for (std::size_t i = 0; i < column.size(); ++i) {
+      const auto value = enchantum::cast<Country>(column[i]);
+      valid += value.has_value();
+      values[i] = value.value_or(Country{});
+    }
+    return valid;
+  };
+  BENCHMARK(std::string(label) + " cast_batch")
+  {
+    return enchantum::cast_batch<Country>(column.begin(), column.end(), values.data(), validity.data());
+  };
+}
+} // namespace
+
+TEST_CASE("batch cast", "[!benchmark][batch]")
+{
+  bench_batch("distinct rows", 1);
+  bench_batch("runs of 4", 4);
+}
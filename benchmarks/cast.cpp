@@ -0,0 +1,116 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <enchantum/enchantum.hpp>
+#include <string>
+#include <vector>
+
+// generates 2^N enumerators with mixed name lengths e.g `xacea`,`xBbcea`,`xaDdea`
+#define BENCH_E2(p)   p##a, p##Bb
+#define BENCH_E4(p)   BENCH_E2(p##c), BENCH_E2(p##Dd)
+#define BENCH_E8(p)   BENCH_E4(p##e), BENCH_E4(p##Ff)
+#define BENCH_E16(p)  BENCH_E8(p##g), BENCH_E8(p##Hh)
+#define BENCH_E32(p)  BENCH_E16(p##i), BENCH_E16(p##Jj)
+#define BENCH_E64(p)  BENCH_E32(p##k), BENCH_E32(p##Ll)
+#define BENCH_E128(p) BENCH_E64(p##m), BENCH_E64(p##Nn)
+#define BENCH_E256(p) BENCH_E128(p##o), BENCH_E128(p##Pp)
+
+namespace {
+enum class Names4 { BENCH_E4(x) };
+enum class Names8 { BENCH_E8(x) };
+enum class Names16 { BENCH_E16(x) };
+enum class Names32 { BENCH_E32(x) };
+enum class Names64 { BENCH_E64(x) };
+enum class Names128 { BENCH_E128(x) };
+enum class Names256 { BENCH_E256(x) };
+
+// the lookup enchantum::cast used before the hash table, kept as the baseline
+template<typename E>
+std::size_t linear_name_index(const enchantum::string_view name)
+{
+  constexpr auto minmax = enchantum::details::minmax_string_size(enchantum::names<E>.data(),
+                                                                 enchantum::names<E>.data() + enchantum::names<E>.size());
+  if (name.size() < minmax.first || name.size() > minmax.second)
+    return enchantum::count<E>;
+  for (std::size_t i = 0; i < enchantum::count<E>; ++i)
+    if (enchantum::names_generator<E>[i] == name)
+      return i;
+  return enchantum::count<E>;
+}
+
+// every name once and a same length miss for every name
+template<typename E>
+std::vector<std::string> make_inputs()
+{
+  std::vector<std::string> inputs;
+  for (const auto name : enchantum::names<E>) {
+    inputs.emplace_back(name);
+    inputs.emplace_back(name);
+    inputs.back().back() = '_';
+  }
+  return inputs;
+}
+
+template<typename E>
+void bench_cast(const char* const label)
+{
+  const auto inputs = make_inputs<E>();
+  BENCHMARK(std::string(label) + " linear scan")
+  {
+    std::size_t sum = 0;
+    for (const auto& s : inputs)
+      sum += linear_name_index<E>(s);
+    return sum;
+  };
+  BENCHMARK(std::string(label) + " perfect hash")
+  {
+    std::size_t sum = 0;
+    for (const auto& s : inputs)
+      sum += enchantum::details::hashed_name_index<E>(s);
+    return sum;
+  };
+}
+
+template<typename E>
+void bench_cast_case_insensitive(const char* const label)
+{
+  auto inputs = make_inputs<E>();
+  for (auto& s : inputs)
+    for (auto& c : s)
+      c = static_cast<char>(c >= 'a' && c <= 'z' ? c - ('a' - 'A') : c);
+
+  BENCHMARK(std::string(label) + " per character predicate")
+  {
+    std::size_t found = 0;
+    for (const auto& s : inputs)
+      found += enchantum::cast<E>(s, [](const char a, const char b) {
+                 return enchantum::details::ascii_tolower(a) == enchantum::details::ascii_tolower(b);
+               }).has_value();
+    return found;
+  };
+  BENCHMARK(std::string(label) + " ascii_case_insensitive")
+  {
+    std::size_t found = 0;
+    for (const auto& s : inputs)
+      found += enchantum::cast<E>(s, enchantum::ascii_case_insensitive).has_value();
+    return found;
+  };
+}
+} // namespace
+
+TEST_CASE("cast<E>(string_view) linear scan vs perfect hash", "[!benchmark][cast]")
+{
+  bench_cast<Names4>("4 names");
+  bench_cast<Names8>("8 names");
+  bench_cast<Names16>("16 names");
+  bench_cast<Names32>("32 names");
+  bench_cast<Names64>("64 names");
+  bench_cast<Names128>("128 names");
+  bench_cast<Names256>("256 names");
+}
+
+TEST_CASE("case insensitive cast<E>(string_view, BinaryPredicate)", "[!benchmark][cast]")
+{
+  bench_cast_case_insensitive<Names8>("8 names");
+  bench_cast_case_insensitive<Names32>("32 names");
+  bench_cast_case_insensitive<Names128>("128 names");
+}
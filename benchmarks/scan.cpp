@@ -0,0 +1,81 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <enchantum/enchantum.hpp>
+#include <enchantum/scan.hpp>
+#include <string>
+
+namespace {
+enum class ErrorCode {
+  NotFound,
+  AccessDenied,
+  AlreadyExists,
+  NotADirectory,
+  IsADirectory,
+  InvalidArgument,
+  TooManyOpenFilesInSystem,
+  TooManyOpenFiles,
+  NoSpaceLeft,
+  ReadOnlyFileSystem,
+  BrokenPipe,
+  TryAgain,
+  OutOfMemory,
+  BadAddress,
+  DeviceBusy,
+  CrossDeviceLink,
+  NoSuchDevice,
+  TextFileBusy,
+  FileTooLarge,
+  IllegalSeek,
+  TooManyLinks,
+  DomainError,
+  ResultOutOfRange,
+  Deadlock,
+  NameTooLong,
+  NoLocks,
+  NotImplemented,
+  DirectoryNotEmpty,
+  SymlinkLoop,
+  NoMessage,
+  TimedOut,
+  ConnectionRefused,
+};
+
+// a log where about one line in eight mentions an error code
+std::string make_log()
+{
+  std::string log;
+  for (std::size_t i = 0; log.size() < (1 << 20); ++i) {
+    log += "2024-01-01T00:00:00 worker=";
+    log += std::to_string(i);
+    log += " request handled in 12ms status=ok";
+    if (i % 8 == 0) {
+      log += " error=";
+      const auto name = enchantum::names<ErrorCode>[i / 8 % enchantum::count<ErrorCode>];
+      log.append(name.data(), name.size());
+    }
+    log += '\n';
+  }
+  return log;
+}
+} // namespace
+
+TEST_CASE("scan names", "[!benchmark][scan]")
+{
+  const auto                   log = make_log();
+  const enchantum::string_view text(log);
+
+  BENCHMARK("find per name")
+  {
+    std::size_t sum = 0;
+    for (const auto name : enchantum::names<ErrorCode>)
+      for (auto pos = text.find(name); pos != text.npos; pos = text.find(name, pos + 1))
+        sum += pos;
+    return sum;
+  };
+  BENCHMARK("scan_names")
+  {
+    std::size_t sum = 0;
+    enchantum::scan_names<ErrorCode>(text, [&](const std::size_t offset, ErrorCode) { sum += offset; });
+    return sum;
+  };
+}
@@ -0,0 +1,181 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <enchantum/enchantum.hpp>
+#include <string>
+#include <vector>
+
+// sparse values spanning [0, 4000], too wide for a dense table
+#define BENCH_SPARSE32 \
+  v153 = 153, \
+  v197 = 197, \
+  v237 = 237, \
+  v242 = 242, \
+  v286 = 286, \
+  v296 = 296, \
+  v352 = 352, \
+  v371 = 371, \
+  v385 = 385, \
+  v507 = 507, \
+  v617 = 617, \
+  v879 = 879, \
+  v914 = 914, \
+  v985 = 985, \
+  v1326 = 1326, \
+  v1497 = 1497, \
+  v1617 = 1617, \
+  v1712 = 1712, \
+  v1738 = 1738, \
+  v1776 = 1776, \
+  v2078 = 2078, \
+  v2194 = 2194, \
+  v2257 = 2257, \
+  v2316 = 2316, \
+  v2387 = 2387, \
+  v2583 = 2583, \
+  v2666 = 2666, \
+  v3363 = 3363, \
+  v3386 = 3386, \
+  v3726 = 3726, \
+  v3880 = 3880, \
+  v3882 = 3882
+
+#define BENCH_SPARSE80 \
+  v160 = 160, \
+  v190 = 190, \
+  v203 = 203, \
+  v244 = 244, \
+  v253 = 253, \
+  v257 = 257, \
+  v299 = 299, \
+  v335 = 335, \
+  v399 = 399, \
+  v422 = 422, \
+  v482 = 482, \
+  v483 = 483, \
+  v545 = 545, \
+  v590 = 590, \
+  v622 = 622, \
+  v675 = 675, \
+  v736 = 736, \
+  v740 = 740, \
+  v769 = 769, \
+  v843 = 843, \
+  v905 = 905, \
+  v999 = 999, \
+  v1017 = 1017, \
+  v1179 = 1179, \
+  v1186 = 1186, \
+  v1227 = 1227, \
+  v1229 = 1229, \
+  v1263 = 1263, \
+  v1286 = 1286, \
+  v1401 = 1401, \
+  v1406 = 1406, \
+  v1481 = 1481, \
+  v1525 = 1525, \
+  v1624 = 1624, \
+  v1712 = 1712, \
+  v1716 = 1716, \
+  v1727 = 1727, \
+  v1751 = 1751, \
+  v1838 = 1838, \
+  v1856 = 1856, \
+  v1907 = 1907, \
+  v2002 = 2002, \
+  v2027 = 2027, \
+  v2033 = 2033, \
+  v2096 = 2096, \
+  v2151 = 2151, \
+  v2177 = 2177, \
+  v2214 = 2214, \
+  v2243 = 2243, \
+  v2280 = 2280, \
+  v2294 = 2294, \
+  v2311 = 2311, \
+  v2338 = 2338, \
+  v2339 = 2339, \
+  v2352 = 2352, \
+  v2363 = 2363, \
+  v2382 = 2382, \
+  v2387 = 2387, \
+  v2398 = 2398, \
+  v2494 = 2494, \
+  v2535 = 2535, \
+  v2569 = 2569, \
+  v2616 = 2616, \
+  v2786 = 2786, \
+  v2793 = 2793, \
+  v2863 = 2863, \
+  v2916 = 2916, \
+  v2987 = 2987, \
+  v3101 = 3101, \
+  v3183 = 3183, \
+  v3194 = 3194, \
+  v3253 = 3253, \
+  v3342 = 3342, \
+  v3516 = 3516, \
+  v3584 = 3584, \
+  v3782 = 3782, \
+  v3822 = 3822, \
+  v3881 = 3881, \
+  v3940 = 3940, \
+  v3998 = 3998
+
+#define BENCH_SPARSE_ENUM(Name, Values, Strategy)                         \
+  enum class Name { Values };                                             \
+  template<>                                                              \
+  struct enchantum::enum_traits<Name> {                                   \
+    static constexpr auto min          = 0;                               \
+    static constexpr auto max          = 4000;                            \
+    static constexpr auto index_lookup = index_lookup_strategy::Strategy; \
+  }
+
+BENCH_SPARSE_ENUM(Linear32, BENCH_SPARSE32, linear);
+BENCH_SPARSE_ENUM(Binary32, BENCH_SPARSE32, binary_search);
+BENCH_SPARSE_ENUM(Eytzinger32, BENCH_SPARSE32, eytzinger);
+BENCH_SPARSE_ENUM(Packed32, BENCH_SPARSE32, packed_scan);
+BENCH_SPARSE_ENUM(Linear80, BENCH_SPARSE80, linear);
+BENCH_SPARSE_ENUM(Binary80, BENCH_SPARSE80, binary_search);
+BENCH_SPARSE_ENUM(Eytzinger80, BENCH_SPARSE80, eytzinger);
+BENCH_SPARSE_ENUM(Packed80, BENCH_SPARSE80, packed_scan);
+
+namespace {
+// every value in random order and as many misses
+template<typename E>
+std::vector<E> make_value_inputs()
+{
+  std::vector<E> inputs;
+  for (std::size_t i = 0; i < enchantum::count<E>; ++i) {
+    const auto v = static_cast<int>(enchantum::values<E>[i * 7 % enchantum::count<E>]);
+    inputs.push_back(static_cast<E>(v));
+    inputs.push_back(static_cast<E>(v + 1));
+  }
+  return inputs;
+}
+
+template<typename E>
+void bench_enum_to_index(const char* const label)
+{
+  const auto inputs = make_value_inputs<E>();
+  BENCHMARK(label)
+  {
+    std::size_t sum = 0;
+    for (int repeat = 0; repeat < 64; ++repeat)
+      for (const auto e : inputs)
+        sum += enchantum::enum_to_index(e).value_or(0);
+    return sum;
+  };
+}
+} // namespace
+
+TEST_CASE("enum_to_index strategies", "[!benchmark][enum_to_index]")
+{
+  bench_enum_to_index<Linear32>("32 values linear");
+  bench_enum_to_index<Binary32>("32 values binary_search");
+  bench_enum_to_index<Eytzinger32>("32 values eytzinger");
+  bench_enum_to_index<Packed32>("32 values packed_scan");
+  bench_enum_to_index<Linear80>("80 values linear");
+  bench_enum_to_index<Binary80>("80 values binary_search");
+  bench_enum_to_index<Eytzinger80>("80 values eytzinger");
+  bench_enum_to_index<Packed80>("80 values packed_scan");
+}
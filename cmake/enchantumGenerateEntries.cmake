@@ -0,0 +1,52 @@
+# enchantum_generate_entries(<target>
+#   OUTPUT <header>
+#   ENUMS <enum>...
+#   [HEADERS <header>...]
+#   [LINK_LIBRARIES <library>...])
+#
+# Builds `<target>_generator` which reflects every enum of `ENUMS` once and writes `OUTPUT` with an
+# `ENCHANTUM_DECLARE_ENTRIES` for each of them so translation units including it do not reflect them.
+# `HEADERS` are included to declare the enums and `LINK_LIBRARIES` give the generator their include
+# directories and definitions.
+# `<target>` is an INTERFACE library adding the directory of `OUTPUT` to the include path of its users.
+function(enchantum_generate_entries TARGET)
+  cmake_parse_arguments(PARSE_ARGV 1 ARG "" "OUTPUT" "ENUMS;HEADERS;LINK_LIBRARIES")
+  if(NOT ARG_OUTPUT OR NOT ARG_ENUMS)
+    message(FATAL_ERROR "enchantum_generate_entries: OUTPUT and ENUMS are required")
+  endif()
+  if(NOT IS_ABSOLUTE "${ARG_OUTPUT}")
+    set(ARG_OUTPUT "${CMAKE_CURRENT_BINARY_DIR}/${ARG_OUTPUT}")
+  endif()
+
+  set(ENCHANTUM_INCLUDES "")
+  set(ENCHANTUM_WRITE_INCLUDES "")
+  foreach(header IN LISTS ARG_HEADERS)
+    string(APPEND ENCHANTUM_INCLUDES "#include \"${header}\"\n")
+    string(APPEND ENCHANTUM_WRITE_INCLUDES "  out << \"#include \\\"${header}\\\"\\n\";\n")
+  endforeach()
+
+  set(ENCHANTUM_WRITE_ENTRIES "")
+  foreach(enum IN LISTS ARG_ENUMS)
+    string(APPEND ENCHANTUM_WRITE_ENTRIES "  write_entries<${enum}>(out, \"${enum}\");\n")
+  endforeach()
+
+  set(generator_source "${CMAKE_CURRENT_BINARY_DIR}/${TARGET}_generator.cpp")
+  configure_file("${CMAKE_CURRENT_FUNCTION_LIST_DIR}/enchantum_generate_entries.cpp.in" "${generator_source}" @ONLY)
+
+  add_executable(${TARGET}_generator "${generator_source}")
+  target_link_libraries(${TARGET}_generator PRIVATE enchantum::enchantum ${ARG_LINK_LIBRARIES})
+
+  get_filename_component(output_dir "${ARG_OUTPUT}" DIRECTORY)
+  file(MAKE_DIRECTORY "${output_dir}")
+  add_custom_command(
+    OUTPUT "${ARG_OUTPUT}"
+    COMMAND ${TARGET}_generator "${ARG_OUTPUT}"
+    DEPENDS ${TARGET}_generator
+    COMMENT "Generating enchantum entries ${ARG_OUTPUT}"
+    VERBATIM
+  )
+
+  add_library(${TARGET} INTERFACE "${ARG_OUTPUT}")
+  target_include_directories(${TARGET} INTERFACE "${output_dir}")
+  target_link_libraries(${TARGET} INTERFACE enchantum::enchantum ${ARG_LINK_LIBRARIES})
+endfunction()
@@ -6,17 +6,28 @@
 #include "details/string.hpp" // IWYU pragma: export:
 #include "details/string_view.hpp" // IWYU pragma: export:
 #include "details/shared.hpp" // IWYU pragma: export:
+#include "details/char_names.hpp" // IWYU pragma: export:
 #include "details/format_util.hpp" // IWYU pragma: export:
+#include "details/name_hash.hpp" // IWYU pragma: export:
+#include "details/sorted_names.hpp" // IWYU pragma: export:
+#include "details/name_trie.hpp" // IWYU pragma: export:
+#include "details/name_automaton.hpp" // IWYU pragma: export:
+#include "details/scoped_names.hpp" // IWYU pragma: export:
+#include "details/value_index.hpp" // IWYU pragma: export:
 #include "generators.hpp" // IWYU pragma: export:
 #include "algorithms.hpp" // IWYU pragma: export:
 #include "array.hpp" // IWYU pragma: export:
+#include "batch.hpp" // IWYU pragma: export:
 #include "bitset.hpp" // IWYU pragma: export:
 #include "bitflags.hpp" // IWYU pragma: export:
 #include "bitwise_operators.hpp" // IWYU pragma: export:
+#include "charconv.hpp" // IWYU pragma: export:
 #include "enchantum.hpp" // IWYU pragma: export:
 #include "entries.hpp" // IWYU pragma: export:
 #include "iostream.hpp" // IWYU pragma: export:
 #include "next_value.hpp" // IWYU pragma: export:
+#include "prefix.hpp" // IWYU pragma: export:
+#include "scan.hpp" // IWYU pragma: export:
 
 #if __has_include(<fmt/format.h>)
   #include "fmt_format.hpp" // IWYU pragma: export:
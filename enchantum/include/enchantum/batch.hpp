@@ -0,0 +1,92 @@
+#pragma once
+
+#include "common.hpp"
+#include "details/string_view.hpp"
+#include "enchantum.hpp"
+#include "generators.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace enchantum {
+namespace details {
+
+  constexpr bool equal_chars(const char* const a, const char* const b, const std::size_t size) noexcept
+  {
+    for (std::size_t i = 0; i < size; ++i)
+      if (a[i] != b[i])
+        return false;
+    return true;
+  }
+
+  // calls `write(index)` for every input with `count<E>` for the inputs that are not names of `E`.
+  // columns tend to repeat the same string in runs so an input equal to the previous one reuses its result.
+  template<typename E, typename InputIt, typename Write>
+  constexpr std::size_t cast_batch(InputIt first, const InputIt last, Write write, std::uint8_t* validity) noexcept
+  {
+    std::size_t  valid      = 0;
+    std::uint8_t bits       = 0;
+    std::size_t  bit        = 0;
+    const char*  prev_data  = nullptr;
+    std::size_t  prev_size  = 0;
+    std::size_t  prev_index = count<E>;
+    for (; first != last; ++first) {
+      const string_view name = *first;
+      const auto        size = name.size();
+      const auto* const data = name.data();
+
+      const bool repeated = prev_data && size == prev_size && details::equal_chars(data, prev_data, size);
+      const auto index    = repeated ? prev_index : details::name_index_of<E>(name);
+      prev_data           = data;
+      prev_size           = size;
+      prev_index          = index;
+
+      write(index);
+      valid += index != count<E>;
+      bits = static_cast<std::uint8_t>(bits | ((index != count<E>) << bit));
+      if (++bit == 8) {
+        if (validity)
+          *validity++ = bits;
+        bits = 0;
+        bit  = 0;
+      }
+    }
+    if (bit != 0 && validity)
+      *validity = bits;
+    return valid;
+  }
+
+} // namespace details
+
+// casts every string in [first, last) to `E` and writes the values to `out`, inputs that are not names write `E{}`.
+// if `validity` is not null bit `i % 8` of `validity[i / 8]` is set if input `i` was a name like an Arrow validity
+// bitmap, it must point to at least `(std::distance(first, last) + 7) / 8` bytes.
+// returns the amount of inputs that were names.
+template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E), typename InputIt>
+constexpr std::size_t cast_batch(const InputIt       first,
+                                 const InputIt       last,
+                                 E*                  out,
+                                 std::uint8_t* const validity = nullptr) noexcept
+{
+  return details::cast_batch<E>(
+    first,
+    last,
+    [&out](const std::size_t i) { *out++ = i != count<E> ? values_generator<E>[i] : E{}; },
+    validity);
+}
+
+// same as `cast_batch` but writes the index of every value in `values<E>` which suits dictionary encoding,
+// inputs that are not names write `count<E>` so `Index` should be able to hold it.
+template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E), typename InputIt, typename Index>
+constexpr std::size_t cast_batch_to_index(const InputIt       first,
+                                          const InputIt       last,
+                                          Index*              indices,
+                                          std::uint8_t* const validity = nullptr) noexcept
+{
+  return details::cast_batch<E>(
+    first,
+    last,
+    [&indices](const std::size_t i) { *indices++ = static_cast<Index>(i); },
+    validity);
+}
+
+} // namespace enchantum
@@ -2,11 +2,19 @@
 #include "common.hpp"
 #include "details/string.hpp"
 #include "details/string_view.hpp"
+#include "details/countr_zero.hpp"
 #include "details/optional.hpp"
 
 #include "enchantum.hpp"
 #include "generators.hpp"
+#include "type_name.hpp"
+#include <array>
 #include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
 
 #if defined(ENCHANTUM_DETAILS_GCC_MAJOR) && ENCHANTUM_DETAILS_GCC_MAJOR <= 10
   #pragma GCC diagnostic push
@@ -44,80 +52,337 @@ template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E)>
   return enchantum::contains_bitflag<E>(static_cast<std::underlying_type_t<E>>(value));
 }
 
+// the result of `parse_bitflag`, `value` is empty if a token is not a name and `position` is the offset of that
+// token otherwise `position` is the size of the input
+template<typename E>
+struct parse_bitflag_result {
+  optional<E> value;
+  std::size_t position = 0;
+};
+
+namespace details {
+  // separators given as a set of characters
+  struct separator_chars {
+    string_view chars;
+
+    [[nodiscard]] constexpr std::size_t operator()(const char* const p, std::size_t) const noexcept
+    {
+      const auto* const data = chars.data();
+      for (std::size_t i = 0; i < chars.size(); ++i)
+        if (data[i] == *p)
+          return 1;
+      return 0;
+    }
+  };
+
+  // separators given as strings, the longest one matching wins
+  struct separator_strings {
+    const string_view* first;
+    const string_view* last;
+
+    [[nodiscard]] constexpr std::size_t operator()(const char* const p, const std::size_t remaining) const noexcept
+    {
+      std::size_t ret = 0;
+      for (auto it = first; it != last; ++it) {
+        const auto size = it->size();
+        if (size > ret && size <= remaining && string_view(p, size) == *it)
+          ret = size;
+      }
+      return ret;
+    }
+  };
+
+  constexpr bool is_ascii_space(const char c) noexcept
+  {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+  }
+
+  // `std::nullptr_t` as `BinaryPred` compares exactly
+  template<typename E, typename BinaryPred>
+  constexpr std::size_t token_to_index(string_view token, const BinaryPred binary_pred, const bool scoped) noexcept
+  {
+    if (scoped) {
+      constexpr auto scope = type_name<E>;
+      const auto     size  = scope.size();
+      if (token.size() < size + 2 || !(string_view(token.data(), size) == scope) || token.data()[size] != ':' ||
+          token.data()[size + 1] != ':')
+        return count<E>;
+      token = string_view(token.data() + size + 2, token.size() - size - 2);
+    }
+
+    if constexpr (std::is_same_v<BinaryPred, std::nullptr_t>) {
+      (void)binary_pred;
+      return details::name_index_of<E>(token);
+    }
+    else if constexpr (details::uses_folded_name_hash<E, BinaryPred>) {
+      (void)binary_pred;
+      return details::hashed_folded_name_index<E>(token);
+    }
+    else {
+      for (std::size_t i = 0; i < count<E>; ++i)
+        if (details::call_predicate(binary_pred, token, details::name_at<E>(i)))
+          return i;
+      return count<E>;
+    }
+  }
+
+  // splits `input` on `separator` in a single pass and ORs the flags the tokens name.
+  // `separator(p, remaining)` returns the length of the separator starting at `p` or 0.
+  template<typename E, typename Separator, typename BinaryPred>
+  constexpr parse_bitflag_result<E> parse_bitflag(const string_view input,
+                                                  const Separator   separator,
+                                                  const BinaryPred  binary_pred,
+                                                  const bool        scoped,
+                                                  const bool        trim) noexcept
+  {
+    using T                = std::underlying_type_t<E>;
+    const auto* const data = input.data();
+    const auto        size = input.size();
+
+    T           value{};
+    std::size_t pos = 0;
+    while (true) {
+      std::size_t end     = pos;
+      std::size_t sep_len = 0;
+      while (end < size && (sep_len = separator(data + end, size - end)) == 0)
+        ++end;
+
+      std::size_t first = pos;
+      std::size_t last  = end;
+      if (trim) {
+        while (first < last && details::is_ascii_space(data[first]))
+          ++first;
+        while (last > first && details::is_ascii_space(data[last - 1]))
+          --last;
+      }
+
+      const auto i = details::token_to_index<E>(string_view(data + first, last - first), binary_pred, scoped);
+      if (i == count<E>)
+        return {optional<E>(), first};
+      value = static_cast<T>(value | static_cast<T>(values_generator<E>[i]));
+
+      if (end == size)
+        return {optional<E>(static_cast<E>(value)), size};
+      pos = end + sep_len;
+    }
+  }
+
+  // the form `cast_bitflag` and `contains_bitflag` accept, a single separator character and no whitespace
+  template<typename E, typename BinaryPred>
+  constexpr optional<E> cast_bitflag(const string_view s,
+                                     const char        sep,
+                                     const BinaryPred  binary_pred,
+                                     const bool        scoped) noexcept
+  {
+    const char seps[]    = {sep};
+    const auto separator = details::separator_chars{string_view(seps, 1)};
+    return details::parse_bitflag<E>(s, separator, binary_pred, scoped, false).value;
+  }
+} // namespace details
+
+// parses flags separated by any of the characters in `separators` ignoring whitespace around every flag
+// e.g `"Read | Write"` or `"Read,Write"` with `separators` being `"|,"`.
+template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E), typename BinaryPred>
+[[nodiscard]] constexpr parse_bitflag_result<E> parse_bitflag(const string_view input,
+                                                              const string_view separators,
+                                                              const BinaryPred  binary_pred) noexcept
+{
+  return details::parse_bitflag<E>(input, details::separator_chars{separators}, binary_pred, false, true);
+}
+
+template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E)>
+[[nodiscard]] constexpr parse_bitflag_result<E> parse_bitflag(const string_view input,
+                                                              const string_view separators = "|") noexcept
+{
+  return details::parse_bitflag<E>(input, details::separator_chars{separators}, nullptr, false, true);
+}
+
+// same as above but the separators are strings e.g `{"|", "||", "and"}`
+template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E), typename BinaryPred>
+[[nodiscard]] constexpr parse_bitflag_result<E> parse_bitflag(
+  const string_view                        input,
+  const std::initializer_list<string_view> separators,
+  const BinaryPred                         binary_pred) noexcept
+{
+  return details::parse_bitflag<E>(input,
+                                   details::separator_strings{separators.begin(), separators.end()},
+                                   binary_pred,
+                                   false,
+                                   true);
+}
+
+template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E)>
+[[nodiscard]] constexpr parse_bitflag_result<E> parse_bitflag(
+  const string_view                        input,
+  const std::initializer_list<string_view> separators) noexcept
+{
+  return details::parse_bitflag<E>(input,
+                                   details::separator_strings{separators.begin(), separators.end()},
+                                   nullptr,
+                                   false,
+                                   true);
+}
+
 template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E), typename BinaryPred>
 [[nodiscard]] constexpr bool contains_bitflag(const string_view s, const char sep, const BinaryPred binary_pred) noexcept
 {
-  std::size_t pos = 0;
-  for (std::size_t i = s.find(sep); i != s.npos; i = s.find(sep, pos)) {
-    if (!enchantum::contains<E>(s.substr(pos, i - pos), binary_pred))
-      return false;
-    pos = i + 1;
-  }
-  return enchantum::contains<E>(s.substr(pos), binary_pred);
+  return static_cast<bool>(details::cast_bitflag<E>(s, sep, binary_pred, false));
 }
 
 
 template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E)>
 [[nodiscard]] constexpr bool contains_bitflag(const string_view s, const char sep = '|') noexcept
 {
-  std::size_t pos = 0;
-  for (std::size_t i = s.find(sep); i != s.npos; i = s.find(sep, pos)) {
-    if (!enchantum::contains<E>(s.substr(pos, i - pos)))
-      return false;
-    pos = i + 1;
-  }
-  return enchantum::contains<E>(s.substr(pos));
+  return static_cast<bool>(details::cast_bitflag<E>(s, sep, nullptr, false));
 }
 
 
+namespace details {
+  // whether every flag is a single bit so the flags of a value are its set bits
+  template<typename E>
+  inline constexpr bool has_single_bit_flags = []() {
+    using U = unsigned_underlying_type_t<E>;
+    for (auto i = std::size_t{has_zero_flag<E>}; i < count<E>; ++i) {
+      const auto u = static_cast<U>(values_generator<E>[i]);
+      if ((u & (u - 1)) != 0)
+        return false;
+    }
+    return true;
+  }();
+
+  // the index in `values<E>` of the flag at every bit or `count<E>` for bits no flag has
+  template<typename E>
+  inline constexpr auto flag_bit_index = []() {
+    using U         = unsigned_underlying_type_t<E>;
+    using IndexType = value_index_type_t<E>;
+    std::array<IndexType, std::numeric_limits<U>::digits> ret{};
+    for (auto& i : ret)
+      i = static_cast<IndexType>(count<E>);
+    for (auto i = std::size_t{has_zero_flag<E>}; i < count<E>; ++i)
+      ret[static_cast<std::size_t>(details::countr_zero(static_cast<U>(values_generator<E>[i])))] =
+        static_cast<IndexType>(i);
+    return ret;
+  }();
+
+  // the index of the flag at the lowest set bit of `bits`, for `has_single_bit_flags<E>` enums
+  template<typename E>
+  constexpr std::size_t lowest_flag_index(const unsigned_underlying_type_t<E> bits) noexcept
+  {
+    using U = unsigned_underlying_type_t<E>;
+    if constexpr (is_contiguous_bitflag<E>) {
+      constexpr auto first_bit = details::countr_zero(static_cast<U>(values_generator<E>[has_zero_flag<E>]));
+      return std::size_t{has_zero_flag<E>} + static_cast<std::size_t>(details::countr_zero(bits) - first_bit);
+    }
+    else {
+      return flag_bit_index<E>[static_cast<std::size_t>(details::countr_zero(bits))];
+    }
+  }
+
+  // calls `func(index)` for the flags set in `value` in order of `values<E>`,
+  // returns false without calling it if the flags do not cover every bit of `value`
+  template<typename E, typename Func>
+  constexpr bool for_each_set_flag(const E value, Func func)
+  {
+    using T = std::underlying_type_t<E>;
+    if constexpr (has_single_bit_flags<E> && (count<E> > std::size_t{has_zero_flag<E>})) {
+      // only the set bits are visited
+      if (!enchantum::contains_bitflag(value))
+        return false;
+      using U = unsigned_underlying_type_t<E>;
+      for (auto u = static_cast<U>(value); u != 0; u = static_cast<U>(u & (u - 1)))
+        func(details::lowest_flag_index<E>(u));
+    }
+    else {
+      T check_value = 0;
+      for (auto i = std::size_t{has_zero_flag<E>}; i < count<E>; ++i) {
+        const auto v = static_cast<T>(values_generator<E>[i]);
+        if (v == (static_cast<T>(value) & v))
+          check_value |= v;
+      }
+      if (check_value != static_cast<T>(value))
+        return false;
+      for (auto i = std::size_t{has_zero_flag<E>}; i < count<E>; ++i) {
+        const auto v = static_cast<T>(values_generator<E>[i]);
+        if (v == (static_cast<T>(value) & v))
+          func(i);
+      }
+    }
+    return true;
+  }
+
+  template<typename OutputIt>
+  constexpr OutputIt copy_string(const string_view s, OutputIt out)
+  {
+    const auto* const data = s.data();
+    for (std::size_t i = 0; i < s.size(); ++i)
+      *out++ = data[i];
+    return out;
+  }
+} // namespace details
+
+// the longest string `to_string_bitflag` can return for `E`, every flag once with single character separators
+template<typename E>
+inline constexpr std::size_t to_string_bitflag_max_size = [] {
+  static_assert(is_bitflag<E>, "");
+  std::size_t ret = 0;
+  for (auto i = std::size_t{has_zero_flag<E>}; i < count<E>; ++i)
+    ret += names_generator<E>[i].size() + (i != has_zero_flag<E>);
+  if constexpr (has_zero_flag<E>)
+    return details::Max(ret, names_generator<E>[0].size());
+  else
+    return ret;
+}();
+
 template<typename String = string, ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E)>
 [[nodiscard]] constexpr String to_string_bitflag(const E value, const char sep = '|')
 {
   using T = std::underlying_type_t<E>;
   if constexpr (has_zero_flag<E>)
     if (static_cast<T>(value) == 0)
-      return String(names_generator<E>[0]);
-
-  String name;
-  T      check_value = 0;
-  for (auto i = std::size_t{has_zero_flag<E>}; i < count<E>; ++i) {
-    const auto v = static_cast<T>(values_generator<E>[i]);
-    if (v == (static_cast<T>(value) & v)) {
-      const auto s = names_generator<E>[i];
-      if (!name.empty())
-        name.append(1, sep);           // append separator if not the first value
-      name.append(s.data(), s.size()); // not using operator += since this may not be std::string_view always
-      check_value |= v;
-    }
-  }
-  if (check_value == static_cast<T>(value))
+      return String(details::name_at<E>(0));
+
+  String     name;
+  const bool valid = details::for_each_set_flag(value, [&name, sep](const std::size_t i) {
+    const auto s = details::name_at<E>(i);
+    if (!name.empty())
+      name.append(1, sep);           // append separator if not the first value
+    name.append(s.data(), s.size()); // not using operator += since this may not be std::string_view always
+  });
+  if (valid)
     return name;
   return String();
 }
 
-template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E), typename BinaryPred>
-[[nodiscard]] constexpr optional<E> cast_bitflag(const string_view s, const char sep, const BinaryPred binary_pred) noexcept
+// writes what `to_string_bitflag(value, sep)` returns to `out` and returns the end of the output, so nothing is
+// written if `value` has no names. at most `to_string_bitflag_max_size<E>` characters are written.
+template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E), typename OutputIt>
+constexpr OutputIt to_string_bitflag(OutputIt out, const E value, const char sep = '|')
 {
   using T = std::underlying_type_t<E>;
-  T           check_value{};
-  std::size_t pos = 0;
-  for (std::size_t i = s.find(sep); i != s.npos; i = s.find(sep, pos)) {
-    if (const auto v = enchantum::cast<E>(s.substr(pos, i - pos), binary_pred))
-      check_value |= static_cast<T>(*v);
-    else
-      return optional<E>();
-    pos = i + 1;
-  }
+  if constexpr (has_zero_flag<E>)
+    if (static_cast<T>(value) == 0)
+      return details::copy_string(details::name_at<E>(0), out);
 
-  if (const auto v = enchantum::cast<E>(s.substr(pos), binary_pred))
-    return optional<E>(static_cast<E>(check_value | static_cast<T>(*v)));
-  return optional<E>();
+  bool first = true;
+  details::for_each_set_flag(value, [&out, &first, sep](const std::size_t i) {
+    if (!first)
+      *out++ = sep;
+    first = false;
+    out   = details::copy_string(details::name_at<E>(i), out);
+  });
+  return out;
+}
+
+template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E), typename BinaryPred>
+[[nodiscard]] constexpr optional<E> cast_bitflag(const string_view s, const char sep, const BinaryPred binary_pred) noexcept
+{
+  return details::cast_bitflag<E>(s, sep, binary_pred, false);
 }
 
 template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E)>
 [[nodiscard]] constexpr optional<E> cast_bitflag(const string_view s, const char sep = '|') noexcept
 {
-  return enchantum::cast_bitflag<E>(s, sep, [](const auto& a, const auto& b) { return a == b; });
+  return details::cast_bitflag<E>(s, sep, nullptr, false);
 }
 
 template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E)>
@@ -126,6 +391,115 @@ template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E)>
   return enchantum::contains_bitflag<E>(value) ? optional<E>(static_cast<E>(value)) : optional<E>();
 }
 
+namespace details {
+  // the flags set in a value, `Value` is `E` or a pair of `E` and its name.
+  // single bit flags are found with `countr_zero` clearing the lowest bit every step,
+  // enums with flags of several bits test every flag instead.
+  template<typename E, typename Value>
+  struct flags_range {
+    using value_type = Value;
+    using U          = unsigned_underlying_type_t<E>;
+
+    struct iterator {
+      using value_type        = Value;
+      using difference_type   = std::ptrdiff_t;
+      using pointer           = void;
+      using reference         = Value;
+      using iterator_category = std::forward_iterator_tag;
+
+      U           bits{};       // the bits not visited yet
+      std::size_t i = count<E>; // the current flag for enums with flags of several bits
+
+      // the index of the current flag in `values<E>`
+      [[nodiscard]] constexpr std::size_t index() const noexcept
+      {
+        if constexpr (has_single_bit_flags<E>)
+          return details::lowest_flag_index<E>(bits);
+        else
+          return i;
+      }
+
+      [[nodiscard]] constexpr Value operator*() const noexcept
+      {
+        const auto n = index();
+        if constexpr (std::is_same_v<Value, E>)
+          return values_generator<E>[n];
+        else
+          return Value{values_generator<E>[n], details::name_at<E>(n)};
+      }
+
+      constexpr iterator& operator++() noexcept
+      {
+        if constexpr (has_single_bit_flags<E>)
+          bits = static_cast<U>(bits & (bits - 1));
+        else
+          i = next_flag(bits, i + 1);
+        return *this;
+      }
+
+      [[nodiscard]] constexpr iterator operator++(int) noexcept
+      {
+        auto copy = *this;
+        ++*this;
+        return copy;
+      }
+
+      [[nodiscard]] constexpr friend bool operator==(const iterator& a, const iterator& b) noexcept
+      {
+        return a.bits == b.bits && a.i == b.i;
+      }
+      [[nodiscard]] constexpr friend bool operator!=(const iterator& a, const iterator& b) noexcept { return !(a == b); }
+    };
+
+    U value{};
+
+    [[nodiscard]] static constexpr std::size_t next_flag(const U v, std::size_t i) noexcept
+    {
+      for (; i < count<E>; ++i) {
+        const auto flag = static_cast<U>(values_generator<E>[i]);
+        if (flag == (v & flag))
+          break;
+      }
+      return i;
+    }
+
+    [[nodiscard]] constexpr iterator begin() const noexcept
+    {
+      if constexpr (has_single_bit_flags<E>)
+        return iterator{static_cast<U>(value & static_cast<U>(value_ors<E>)), count<E>};
+      else
+        return iterator{value, next_flag(value, has_zero_flag<E>)};
+    }
+    [[nodiscard]] constexpr iterator end() const noexcept
+    {
+      if constexpr (has_single_bit_flags<E>)
+        return iterator{0, count<E>};
+      else
+        return iterator{value, count<E>};
+    }
+    [[nodiscard]] constexpr bool empty() const noexcept { return begin() == end(); }
+  };
+} // namespace details
+
+// the flags set in `value` in order of `values<E>` without allocating, bits that are no flag are skipped
+// and the zero flag is never part of it.
+template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E)>
+[[nodiscard]] constexpr details::flags_range<E, E> flags_of(const E value) noexcept
+{
+  return details::flags_range<E, E>{static_cast<details::unsigned_underlying_type_t<E>>(value)};
+}
+
+// same as `flags_of` but yields every flag with its name
+#ifdef __cpp_concepts
+template<BitFlagEnum E, typename Pair = std::pair<E, string_view>>
+#else
+template<typename E, typename Pair = std::pair<E, string_view>, std::enable_if_t<is_bitflag<E>, int> = 0>
+#endif
+[[nodiscard]] constexpr details::flags_range<E, Pair> flag_entries_of(const E value) noexcept
+{
+  return details::flags_range<E, Pair>{static_cast<details::unsigned_underlying_type_t<E>>(value)};
+}
+
 } // namespace enchantum
 
 #if defined(ENCHANTUM_DETAILS_GCC_MAJOR) && ENCHANTUM_DETAILS_GCC_MAJOR <= 10
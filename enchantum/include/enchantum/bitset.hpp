@@ -39,7 +39,7 @@ public:
     string name;
     for (std::size_t i = 0; i < enchantum::count<E>; ++i) {
       if (test(i)) {
-        const auto s = enchantum::names_generator<E>[i];
+        const auto s = details::name_at<E>(i);
         if (!name.empty())
           name += sep;
         name.append(s.data(), s.size()); // not using operator += since this may not be std::string_view always
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "common.hpp"
+#include "details/format_util.hpp"
+#include "details/name_trie.hpp"
+#include "details/string_view.hpp"
+#include "enchantum.hpp"
+#include "generators.hpp"
+#include "type_name.hpp"
+#include <charconv>
+#include <cstddef>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+
+namespace enchantum {
+namespace details {
+
+  // parses a decimal `T` with an optional minus sign if `T` is signed like `std::from_chars` does
+  template<typename T>
+  constexpr std::from_chars_result parse_integer(const char* const first, const char* const last, T& value) noexcept
+  {
+    using ULL = unsigned long long;
+
+    const char* it       = first;
+    bool        negative = false;
+    if constexpr (std::is_signed_v<T>) {
+      if (it != last && *it == '-') {
+        negative = true;
+        ++it;
+      }
+    }
+
+    const char* const digits    = it;
+    ULL               magnitude = 0;
+    bool              overflow  = false;
+    for (; it != last && *it >= '0' && *it <= '9'; ++it) {
+      const auto digit = static_cast<ULL>(*it - '0');
+      if (magnitude > (std::numeric_limits<ULL>::max() - digit) / 10)
+        overflow = true;
+      else
+        magnitude = magnitude * 10 + digit;
+    }
+    if (it == digits)
+      return {first, std::errc::invalid_argument};
+
+    constexpr auto max = static_cast<ULL>((std::numeric_limits<T>::max)());
+    if (overflow || magnitude > max + negative)
+      return {it, std::errc::result_out_of_range};
+
+    if constexpr (std::is_signed_v<T>)
+      value = negative ? static_cast<T>(static_cast<std::make_unsigned_t<T>>(0 - magnitude)) : static_cast<T>(magnitude);
+    else
+      value = static_cast<T>(magnitude);
+    return {it, std::errc{}};
+  }
+
+  // the index of the longest name of `E` starting at `it` which must be prefixed by `type_name<E>::` if `scoped`.
+  // advances `it` past the name if there is one otherwise returns `count<E>`
+  template<typename E>
+  constexpr std::size_t parse_name(const char*& it, const char* const last, const bool scoped) noexcept
+  {
+    const char* first = it;
+    if (scoped) {
+      constexpr auto scope = type_name<E>;
+      constexpr auto size  = scope.size();
+      if (static_cast<std::size_t>(last - first) < size + 2 || !(string_view(first, size) == scope) ||
+          first[size] != ':' || first[size + 1] != ':')
+        return count<E>;
+      first += size + 2;
+    }
+    const auto name = details::longest_name_prefix<E>(string_view(first, static_cast<std::size_t>(last - first)));
+    if (name.first != count<E>)
+      it = first + name.second;
+    return name.first;
+  }
+
+  struct to_chars_functor {
+    template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
+    constexpr std::to_chars_result operator()(char* const          first,
+                                              char* const          last,
+                                              const E              value,
+                                              const format_options options = {}) const noexcept
+    {
+      const auto capacity = static_cast<std::size_t>(last - first);
+      if (capacity >= max_format_size<E>)
+        return {details::format_to(first, value, options), std::errc{}};
+
+      format_buffer<E> buffer{};
+      const auto       s = details::format(value, buffer, options);
+      if (s.size() > capacity)
+        return {last, std::errc::value_too_large};
+      return {details::write_string(first, s), std::errc{}};
+    }
+  };
+
+  struct from_chars_functor {
+    template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
+    constexpr std::from_chars_result operator()(const char* const    first,
+                                                const char* const    last,
+                                                E&                   value,
+                                                const format_options options = {}) const noexcept
+    {
+      using T = std::underlying_type_t<E>;
+      if (!options.underlying) {
+        const char* it = first;
+        if (const auto i = details::parse_name<E>(it, last, options.scoped); i != count<E>) {
+          auto result = static_cast<T>(values_generator<E>[i]);
+          if constexpr (is_bitflag<E>) {
+            while (it != last && *it == options.sep) {
+              const char* next = it + 1;
+              const auto  j    = details::parse_name<E>(next, last, options.scoped);
+              if (j == count<E>)
+                break; // the separator is not part of the value
+              result = static_cast<T>(result | static_cast<T>(values_generator<E>[j]));
+              it     = next;
+            }
+          }
+          value = static_cast<E>(result);
+          return {it, std::errc{}};
+        }
+      }
+
+      T    v{};
+      auto ret = details::parse_integer(first, last, v);
+      if (ret.ec == std::errc{})
+        value = static_cast<E>(v);
+      return ret;
+    }
+  };
+
+} // namespace details
+
+// writes `value` to [first, last) as its name, its flags separated by `options.sep` for bitflags
+// or its underlying value if it has no name or `options.underlying` is set, names are qualified if `options.scoped`.
+// returns `{last, std::errc::value_too_large}` if the text does not fit, never allocates.
+inline constexpr details::to_chars_functor to_chars{};
+
+// reads the longest value of `E` at the start of [first, last) in any form `to_chars` writes with the same options.
+// `value` is only modified on success, a failure returns `{first, std::errc::invalid_argument}`
+// or `std::errc::result_out_of_range` if a number does not fit the underlying type.
+inline constexpr details::from_chars_functor from_chars{};
+
+} // namespace enchantum
@@ -13,6 +13,19 @@
 // clang-format on
 #endif
 
+// tells the optimizer `cond` holds, it is checked by `ENCHANTUM_ASSERT` instead when `NDEBUG` is not defined
+#ifndef ENCHANTUM_ASSUME
+  #if !defined(NDEBUG)
+    #define ENCHANTUM_ASSUME(cond) ENCHANTUM_ASSERT(cond, "assumption failed", #cond)
+  #elif defined(__GNUC__)
+    #define ENCHANTUM_ASSUME(cond) (static_cast<bool>(cond) ? void(0) : __builtin_unreachable())
+  #elif defined(_MSC_VER)
+    #define ENCHANTUM_ASSUME(cond) __assume(cond)
+  #else
+    #define ENCHANTUM_ASSUME(cond) ((void)0)
+  #endif
+#endif
+
 #ifndef ENCHANTUM_THROW
   // additional info such as local variables are here
   #define ENCHANTUM_THROW(exception, ...) throw exception
@@ -25,6 +38,12 @@
   #define ENCHANTUM_MIN_RANGE (-ENCHANTUM_MAX_RANGE)
 #endif
 
+// the most values the gcc and clang backends reflect in one instantiation,
+// larger ranges are split into chunks that are parsed one after another
+#ifndef ENCHANTUM_REFLECTION_CHUNK_SIZE
+  #define ENCHANTUM_REFLECTION_CHUNK_SIZE 1024
+#endif
+
 namespace enchantum {
 
 template<typename T, bool = std::is_enum_v<T>>
@@ -187,6 +206,17 @@ namespace details {
 } // namespace details
 
 
+// how `enum_to_index` and `contains` find a value of an enum whose values are not contiguous.
+// the default is picked from the span between `min<E>` and `max<E>` and can be overridden
+// with a `static constexpr enchantum::index_lookup_strategy index_lookup` member of `enum_traits`.
+enum class index_lookup_strategy : unsigned char {
+  linear,        // compares the value against every value of the enum
+  dense_table,   // one table entry for every value between `min<E>` and `max<E>`
+  binary_search, // binary search over the sorted values
+  eytzinger,     // binary search over the sorted values stored in breadth first order of the search tree
+  packed_scan,   // counts the values less than the value in a branchless loop compilers vectorize
+};
+
 template<typename E>
 struct enum_traits {
 private:
@@ -0,0 +1,171 @@
+#pragma once
+
+#include "../common.hpp"
+#include "../entries.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace enchantum {
+namespace details {
+
+  // the character types names are transcoded to from the UTF-8 names the compiler gives us.
+  // `wchar_t` is UTF-16 where it is 2 bytes wide (Windows) and UTF-32 otherwise
+  template<typename CharT>
+  inline constexpr bool is_transcoded_char = std::is_same_v<CharT, wchar_t> || std::is_same_v<CharT, char16_t> ||
+    std::is_same_v<CharT, char32_t>
+#ifdef __cpp_char8_t
+    || std::is_same_v<CharT, char8_t>
+#endif
+    ;
+
+  // the character type of a string type such as `std::wstring_view`, `char` if it has no `value_type`
+  template<typename String, typename = void>
+  struct string_char_type {
+    using type = char;
+  };
+
+  template<typename String>
+  struct string_char_type<String, std::void_t<typename String::value_type>> {
+    using type = std::remove_cv_t<typename String::value_type>;
+  };
+
+  template<typename CharT>
+  inline constexpr bool is_utf16_char = sizeof(CharT) == 2;
+
+  inline constexpr char32_t replacement_character = 0xFFFD;
+
+  // decodes the code point starting at `data[i]` and moves `i` past it, malformed sequences decode to U+FFFD
+  constexpr char32_t decode_utf8(const char* const data, const std::size_t size, std::size_t& i) noexcept
+  {
+    const auto lead = static_cast<unsigned char>(data[i++]);
+    if (lead < 0x80)
+      return lead;
+
+    std::size_t length = 0;
+    char32_t    cp     = 0;
+    if ((lead & 0xE0) == 0xC0) {
+      length = 1;
+      cp     = lead & 0x1Fu;
+    }
+    else if ((lead & 0xF0) == 0xE0) {
+      length = 2;
+      cp     = lead & 0x0Fu;
+    }
+    else if ((lead & 0xF8) == 0xF0) {
+      length = 3;
+      cp     = lead & 0x07u;
+    }
+    else {
+      return replacement_character;
+    }
+
+    for (; length != 0; --length) {
+      if (i == size || (static_cast<unsigned char>(data[i]) & 0xC0) != 0x80)
+        return replacement_character;
+      cp = (cp << 6) | (static_cast<unsigned char>(data[i++]) & 0x3Fu);
+    }
+    return cp;
+  }
+
+  // writes `cp` to `out` if it is not null, returns the number of `CharT`s it takes
+  template<typename CharT>
+  constexpr std::size_t encode_code_point(const char32_t cp, CharT* const out) noexcept
+  {
+    if constexpr (is_utf16_char<CharT>) {
+      if (cp >= 0x10000) {
+        if (out) {
+          out[0] = static_cast<CharT>(0xD800 + ((cp - 0x10000) >> 10));
+          out[1] = static_cast<CharT>(0xDC00 + ((cp - 0x10000) & 0x3FF));
+        }
+        return 2;
+      }
+    }
+    if (out)
+      out[0] = static_cast<CharT>(cp);
+    return 1;
+  }
+
+  // transcodes the UTF-8 name `data` to `out` if it is not null, returns the number of `CharT`s it takes.
+  // `char8_t` is a copy since the names already are UTF-8
+  template<typename CharT>
+  constexpr std::size_t transcode_name(const char* const data, const std::size_t size, CharT* const out) noexcept
+  {
+    if constexpr (sizeof(CharT) == 1) {
+      if (out)
+        for (std::size_t i = 0; i < size; ++i)
+          out[i] = static_cast<CharT>(data[i]);
+      return size;
+    }
+    else {
+      std::size_t n = 0;
+      for (std::size_t i = 0; i < size;)
+        n += details::encode_code_point(details::decode_utf8(data, size, i), out ? out + n : out);
+      return n;
+    }
+  }
+
+  // the names of an enum as `CharT`s stored back to back with a null terminator each.
+  // name `i` is [offsets[i], offsets[i + 1] - 1) of `chars`
+  template<typename CharT, std::size_t Size, std::size_t Count>
+  struct CharNameStorage {
+    std::array<CharT, Size>              chars{};
+    std::array<std::uint32_t, Count + 1> offsets{};
+    std::size_t                          min_size = 0;
+    std::size_t                          max_size = 0;
+    // every name is ASCII so a name has the same hash as its narrow name
+    bool ascii = true;
+  };
+
+  template<typename E, typename CharT>
+  inline constexpr std::size_t char_name_storage_size = []() {
+    std::size_t ret = 0;
+    if constexpr (count<E> != 0) {
+      const auto* const strings = reflection_data_string_storage<E, true>.data();
+      const auto* const indices = reflection_string_indices<E, true>.data();
+      for (std::size_t i = 0; i < count<E>; ++i)
+        ret += details::transcode_name<CharT>(strings + indices[i], indices[i + 1] - indices[i] - 1u, nullptr) + 1;
+    }
+    return ret;
+  }();
+
+  template<typename E, typename CharT>
+  inline constexpr auto char_name_storage = []() {
+    CharNameStorage<CharT, char_name_storage_size<E, CharT>, count<E>> ret{};
+    if constexpr (count<E> != 0) {
+      const auto* const strings = reflection_data_string_storage<E, true>.data();
+      const auto* const indices = reflection_string_indices<E, true>.data();
+      ret.min_size              = static_cast<std::size_t>(-1);
+
+      std::size_t n = 0;
+      for (std::size_t i = 0; i < count<E>; ++i) {
+        const auto* const name = strings + indices[i];
+        const std::size_t size = indices[i + 1] - indices[i] - 1u;
+        for (std::size_t j = 0; j < size; ++j)
+          ret.ascii = ret.ascii && static_cast<unsigned char>(name[j]) < 0x80;
+
+        const auto length = details::transcode_name(name, size, ret.chars.data() + n);
+        ret.offsets[i]    = static_cast<std::uint32_t>(n);
+        ret.min_size      = details::Min(ret.min_size, length);
+        ret.max_size      = details::Max(ret.max_size, length);
+        n += length;
+        ret.chars[n++] = CharT{};
+      }
+      ret.offsets[count<E>] = static_cast<std::uint32_t>(n);
+    }
+    return ret;
+  }();
+
+  // the name of `values<E>[i]` as `CharT`s
+  template<typename E, typename CharT>
+  [[nodiscard]] constexpr std::basic_string_view<CharT> char_name(const std::size_t i) noexcept
+  {
+    constexpr auto& storage = char_name_storage<E, CharT>;
+    return std::basic_string_view<CharT>(storage.chars.data() + storage.offsets[i],
+                                         storage.offsets[i + 1] - storage.offsets[i] - 1);
+  }
+
+} // namespace details
+} // namespace enchantum
@@ -70,20 +70,21 @@ namespace details {
   }
 
 
+  // stores what it finds in the arrays that are not null, with all of them null it only counts the names
   template<bool IsBitFlag, typename IntType>
   constexpr void parse_string(
-    std::size_t         index_check,
-    const char*         str,
-    const std::size_t   least_length_when_casting,
-    const std::size_t   least_length_when_value,
-    const IntType       min,
-    const std::size_t   array_size,
-    const bool          null_terminated,
-    IntType* const      values,
-    std::uint8_t* const string_lengths,
-    char* const         strings,
-    std::size_t&        total_string_length,
-    std::size_t&        valid_count)
+    std::size_t        index_check,
+    const char*        str,
+    const std::size_t  least_length_when_casting,
+    const std::size_t  least_length_when_value,
+    const IntType      min,
+    const std::size_t  array_size,
+    const bool         null_terminated,
+    IntType* const     values,
+    std::size_t* const string_lengths,
+    char* const        strings,
+    std::size_t&       total_string_length,
+    std::size_t&       valid_count)
   {
     (void)index_check;
     for (std::size_t index = 0; index < array_size; ++index) {
@@ -99,62 +100,133 @@ namespace details {
       }
       else {
         str += least_length_when_value;
-        const auto commapos = static_cast<std::size_t>(__builtin_char_memchr(str, ',', UINT8_MAX) - str);
-        if constexpr (IsBitFlag)
-          values[valid_count] = index == 0 ? IntType{} : static_cast<IntType>(IntType{1} << (index - 1));
-        else
-          values[valid_count] = static_cast<IntType>(min + static_cast<IntType>(index));
-        string_lengths[valid_count++] = static_cast<std::uint8_t>(commapos);
-        __builtin_memcpy(strings + total_string_length, str, commapos);
+        // Clang evaluates `__builtin_char_memchr` a character at a time until the first match (like `strchr`)
+        // and every name is followed by ", " because of the dummy 0 so the length never needs to be known
+        const auto commapos = static_cast<std::size_t>(__builtin_char_memchr(str, ',', unbounded_name_length) - str);
+        if (values) {
+          if constexpr (IsBitFlag)
+            values[valid_count] = index == 0 ? IntType{} : static_cast<IntType>(IntType{1} << (index - 1));
+          else
+            values[valid_count] = static_cast<IntType>(min + static_cast<IntType>(index));
+          if (strings) {
+            string_lengths[valid_count] = commapos;
+            __builtin_memcpy(strings + total_string_length, str, commapos);
+          }
+        }
+        ++valid_count;
         total_string_length += commapos + null_terminated;
         str += commapos + SZC(", ");
       }
     }
   }
 
-  template<typename E, bool NullTerminated, auto Min, std::size_t... Is>
-  constexpr auto reflect(std::index_sequence<Is...>) noexcept
+  // the names of the values [Min, Min + sizeof...(Is))
+  template<typename E, auto Min, std::size_t... Is>
+  constexpr auto var_name_of_range(std::index_sequence<Is...>) noexcept
+  {
+    using MinT = decltype(Min);
+    return [](auto dependant) {
+      constexpr bool always_true = sizeof(dependant) != 0;
+      // dummy 0
+      return details::var_name<static_cast<E>(static_cast<MinT>(Is) + Min)..., int(!always_true)>();
+    }(0);
+  }
+
+  // the names of `0` and every bit of the underlying type of `E`
+  template<typename E, std::size_t... Is>
+  constexpr auto var_name_of_flags(std::index_sequence<Is...>) noexcept
   {
-    using MinT       = decltype(Min);
     using T          = std::underlying_type_t<E>;
     using Underlying = std::make_unsigned_t<std::conditional_t<std::is_same_v<bool, T>, unsigned char, T>>;
+    return [](auto dependant) {
+      constexpr bool always_true = sizeof(dependant) != 0;
+      // dummy 0
+      return details::var_name<static_cast<E>(!always_true), static_cast<E>(Underlying(1) << Is)..., 0>();
+    }(0);
+  }
 
-    constexpr auto elements_local = []() {
-      constexpr auto ArraySize = sizeof...(Is) + is_bitflag<E>;
-      const auto     str       = [](auto dependant) {
-        constexpr bool always_true = sizeof(dependant) != 0;
-        // dummy 0
-        if constexpr (always_true && is_bitflag<E>) // sizeof... to make contest dependant
-        {
-          return details::var_name<static_cast<E>(!always_true), static_cast<E>(Underlying(1) << Is)..., 0>();
-        }
-        else {
-          return details::var_name<static_cast<E>(static_cast<MinT>(Is) + Min)..., int(!always_true)>();
-        }
-      }(0);
-
-      constexpr auto enum_in_array_name = details::enum_in_array_name(raw_type_name<E>, is_scoped_enum<E>);
-      constexpr auto enum_in_array_len  = enum_in_array_name.size();
-      // Ubuntu Clang 20 complains about using local constexpr variables in a local struct
-      ReflectStringReturnValue<std::underlying_type_t<E>, ArraySize> ret;
+  template<typename E>
+  inline constexpr auto enum_in_array_name_of = details::enum_in_array_name(raw_type_name<E>, is_scoped_enum<E>);
 
-      // ((anonymous namespace)::A)0
-      // (anonymous namespace)::a
-      // this is needed to determine whether the above are cast expression if 2 braces are
-      // next to eachother then it is a cast but only for anonymoused namespaced enums
-      constexpr std::size_t index_check = enum_in_array_name.size() != 0 && enum_in_array_name[0] == '(' ? 1 : 0;
+  // ((anonymous namespace)::A)0
+  // (anonymous namespace)::a
+  // this is needed to determine whether the above are cast expression if 2 braces are
+  // next to eachother then it is a cast but only for anonymoused namespaced enums
+  template<typename E>
+  inline constexpr std::size_t index_check_of = enum_in_array_name_of<E>.size() != 0 &&
+      enum_in_array_name_of<E>[0] == '('
+    ? 1
+    : 0;
 
-      details::parse_string<is_bitflag<E>>(
-        /*index_check=*/index_check,
-        /*str = */ str,
+  template<typename E>
 #if __clang_major__ > 12
-        /*least_length_when_casting=*/SZC("(") + enum_in_array_len + SZC(")0"),
+  inline constexpr std::size_t least_length_when_casting = SZC("(") + enum_in_array_name_of<E>.size() + SZC(")0");
 #else
-        /*least_length_when_casting=*/1,
+  inline constexpr std::size_t least_length_when_casting = 1;
 #endif
-        /*least_length_when_value=*/details::prefix_length_or_zero<E> +
-          (enum_in_array_len != 0 ? enum_in_array_len + SZC("::") : 0),
-        /*min = */ static_cast<T>(Min),
+
+  template<typename E>
+  inline constexpr std::size_t least_length_when_value = details::prefix_length_or_zero<E> +
+    (enum_in_array_name_of<E>.size() != 0 ? enum_in_array_name_of<E>.size() + SZC("::") : 0);
+
+  // parses the `Size` values starting at `Min + First` into `ret`
+  template<typename E, bool NullTerminated, auto Min, std::size_t First, std::size_t Size, typename Ret>
+  constexpr void reflect_chunk(Ret& ret) noexcept
+  {
+    using MinT               = decltype(Min);
+    constexpr auto chunk_min = static_cast<MinT>(Min + static_cast<MinT>(First));
+    const auto     str       = details::var_name_of_range<E, chunk_min>(std::make_index_sequence<Size>{});
+    details::parse_string<false>(
+      /*index_check=*/index_check_of<E>,
+      /*str = */ str,
+      /*least_length_when_casting=*/least_length_when_casting<E>,
+      /*least_length_when_value=*/least_length_when_value<E>,
+      /*min = */ static_cast<std::underlying_type_t<E>>(chunk_min),
+      /*array_size = */ Size,
+      /*null_terminated= */ NullTerminated,
+      /*enum_values= */ ret.values,
+      /*string_lengths= */ ret.string_lengths,
+      /*strings= */ ret.strings,
+      /*total_string_length*/ ret.total_string_length,
+      /*valid_count*/ ret.valid_count);
+  }
+
+  // one `__PRETTY_FUNCTION__` for the whole range gets expensive for large ranges,
+  // so it is reflected `ChunkSize` values at a time.
+  // the chunks are expanded in an array instead of a fold expression which clang nests
+  // and rejects past `-fbracket-depth` (256) operands.
+  template<typename E,
+           bool        NullTerminated,
+           auto        Min,
+           std::size_t Size,
+           std::size_t ChunkSize,
+           typename Ret,
+           std::size_t... Chunks>
+  constexpr void reflect_chunks(Ret& ret, std::index_sequence<Chunks...>) noexcept
+  {
+    const bool in_order[] = {(details::reflect_chunk<E,
+                                                     NullTerminated,
+                                                     Min,
+                                                     Chunks * ChunkSize,
+                                                     details::reflection_chunk_size(Size, Chunks, ChunkSize)>(ret),
+                              true)...,
+                             true};
+    (void)in_order;
+  }
+
+  template<typename E, bool NullTerminated, auto Min, std::size_t ChunkSize, typename Ret, std::size_t... Is>
+  constexpr void parse_reflection(Ret& ret, std::index_sequence<Is...>) noexcept
+  {
+    constexpr auto ArraySize = sizeof...(Is) + is_bitflag<E>;
+    if constexpr (is_bitflag<E>) {
+      // there are at most as many flags as bits so this is never chunked
+      const auto str = details::var_name_of_flags<E>(std::index_sequence<Is...>{});
+      details::parse_string<true>(
+        /*index_check=*/index_check_of<E>,
+        /*str = */ str,
+        /*least_length_when_casting=*/least_length_when_casting<E>,
+        /*least_length_when_value=*/least_length_when_value<E>,
+        /*min = */ static_cast<std::underlying_type_t<E>>(Min),
         /*array_size = */ ArraySize,
         /*null_terminated= */ NullTerminated,
         /*enum_values= */ ret.values,
@@ -162,42 +234,81 @@ namespace details {
         /*strings= */ ret.strings,
         /*total_string_length*/ ret.total_string_length,
         /*valid_count*/ ret.valid_count);
+    }
+    else {
+      details::reflect_chunks<E, NullTerminated, Min, ArraySize, ChunkSize>(
+        ret, std::make_index_sequence<details::reflection_chunk_count(ArraySize, ChunkSize)>{});
+    }
+  }
 
-      return ret;
-    }();
+  template<typename E, bool NullTerminated, auto Min, std::size_t ChunkSize, std::size_t... Is>
+  constexpr auto reflect_sizes(std::index_sequence<Is...>) noexcept
+  {
+    ReflectStringSizes<std::underlying_type_t<E>> ret;
+    details::parse_reflection<E, NullTerminated, Min, ChunkSize>(ret, std::index_sequence<Is...>{});
+    return ret;
+  }
 
-    using Strings = std::array<char, elements_local.total_string_length>;
+  template<typename E,
+           bool        NullTerminated,
+           auto        Min,
+           std::size_t ChunkSize = ENCHANTUM_REFLECTION_CHUNK_SIZE,
+           std::size_t... Is>
+  constexpr auto reflect(std::index_sequence<Is...>) noexcept
+  {
+    constexpr auto sizes = details::reflect_sizes<E, NullTerminated, Min, ChunkSize>(std::index_sequence<Is...>{});
 
-    struct {
-      decltype(elements_local) elements;
-      Strings                  strings{};
-    } data = {elements_local};
-    __builtin_memcpy(data.strings.data(), elements_local.strings, data.strings.size());
-    return data;
+    ReflectStringReturnValue<std::underlying_type_t<E>, sizes.valid_count, sizes.total_string_length> ret;
+    details::parse_reflection<E, NullTerminated, Min, ChunkSize>(ret, std::index_sequence<Is...>{});
+    return ret;
   }
 
-  template<typename E, auto Min, std::size_t... Is>
-  constexpr bool is_out_of_range(std::index_sequence<Is...>) noexcept
+  // `reflect` without the names, its first pass is the one `reflect<E, true, Min>` does
+  template<typename E, auto Min, std::size_t ChunkSize = ENCHANTUM_REFLECTION_CHUNK_SIZE, std::size_t... Is>
+  constexpr auto reflect_values(std::index_sequence<Is...>) noexcept
   {
-    using MinT       = decltype(Min);
+    constexpr auto sizes = details::reflect_sizes<E, true, Min, ChunkSize>(std::index_sequence<Is...>{});
 
-    constexpr auto ArraySize = sizeof...(Is);
-    const auto     str       = details::var_name<static_cast<E>(static_cast<MinT>(Is) + Min)...,0>();
+    ReflectValuesReturnValue<std::underlying_type_t<E>, sizes.valid_count> ret;
+    details::parse_reflection<E, true, Min, ChunkSize>(ret, std::index_sequence<Is...>{});
+    return ret;
+  }
 
-    constexpr auto enum_in_array_name = details::enum_in_array_name(raw_type_name<E>, is_scoped_enum<E>);
-    constexpr auto enum_in_array_len  = enum_in_array_name.size();
-    constexpr std::size_t index_check = enum_in_array_name.size() != 0 && enum_in_array_name[0] == '(' ? 1 : 0;
-    (void)enum_in_array_len; // not used until Clang 13
+  template<typename E, auto Min, std::size_t First, std::size_t Size>
+  constexpr bool is_out_of_range_chunk() noexcept
+  {
+    using MinT               = decltype(Min);
+    constexpr auto chunk_min = static_cast<MinT>(Min + static_cast<MinT>(First));
+    const auto     str       = details::var_name_of_range<E, chunk_min>(std::make_index_sequence<Size>{});
     return details::is_out_of_range_parse(
-      /*index_check=*/index_check,
+      /*index_check=*/index_check_of<E>,
       /*str = */ str,
-#if __clang_major__ > 12
-      /*least_length_when_casting=*/SZC("(") + enum_in_array_len + SZC(")0"),
-#else
-      /*least_length_when_casting=*/1,
-#endif
-      /*array_size = */ ArraySize);
-  } 
+      /*least_length_when_casting=*/least_length_when_casting<E>,
+      /*array_size = */ Size);
+  }
+
+  template<typename E, auto Min, std::size_t Size, std::size_t... Chunks>
+  constexpr bool is_out_of_range_chunks(std::index_sequence<Chunks...>) noexcept
+  {
+    // an array instead of a `||` fold for the same reason as `reflect_chunks`
+    const bool has_value[] = {details::is_out_of_range_chunk<E,
+                                                             Min,
+                                                             Chunks * ENCHANTUM_REFLECTION_CHUNK_SIZE,
+                                                             details::reflection_chunk_size(Size, Chunks)>()...,
+                              false};
+    for (const auto b : has_value)
+      if (b)
+        return true;
+    return false;
+  }
+
+  template<typename E, auto Min, std::size_t... Is>
+  constexpr bool is_out_of_range(std::index_sequence<Is...>) noexcept
+  {
+    constexpr auto ArraySize = sizeof...(Is);
+    return details::is_out_of_range_chunks<E, Min, ArraySize>(
+      std::make_index_sequence<details::reflection_chunk_count(ArraySize)>{});
+  }
 
 } // namespace details
 
@@ -126,19 +126,20 @@ namespace details {
   }
 
 
+  // stores what it finds in the arrays that are not null, with all of them null it only counts the names
   template<bool IsBitFlag, typename IntType>
   constexpr void parse_string(
-    const char*         str,
-    const std::size_t   least_length_when_casting,
-    const std::size_t   least_length_when_value,
-    const IntType       min,
-    const std::size_t   array_size,
-    const bool          null_terminated,
-    IntType* const      values,
-    std::uint8_t* const string_lengths,
-    char* const         strings,
-    std::size_t&        total_string_length,
-    std::size_t&        valid_count)
+    const char*        str,
+    const std::size_t  least_length_when_casting,
+    const std::size_t  least_length_when_value,
+    const IntType      min,
+    const std::size_t  array_size,
+    const bool         null_terminated,
+    IntType* const     values,
+    std::size_t* const string_lengths,
+    char* const        strings,
+    std::size_t&       total_string_length,
+    std::size_t&       valid_count)
   {
     (void)min; // not always used
     for (std::size_t index = 0; index < array_size; ++index) {
@@ -149,56 +150,113 @@ namespace details {
         str += least_length_when_value;
         // although gcc implementation of std::char_traits::find is using a for loop internally
         // copying the code of the function makes it way slower to compile, this was surprising.
-        const auto commapos = static_cast<std::size_t>(std::char_traits<char>::find(str, UINT8_MAX, ',') - str);
-        if constexpr (IsBitFlag)
-          values[valid_count] = index == 0 ? IntType{} : static_cast<IntType>(IntType{1} << (index - 1));
-        else
-          values[valid_count] = static_cast<IntType>(min + static_cast<IntType>(index));
-        string_lengths[valid_count++] = static_cast<std::uint8_t>(commapos);
-        for (std::size_t i = 0; i < commapos; ++i)
-          strings[total_string_length++] = str[i];
-        total_string_length += null_terminated;
+        const auto commapos = static_cast<std::size_t>(
+          std::char_traits<char>::find(str, unbounded_name_length, ',') - str);
+        if (values) {
+          if constexpr (IsBitFlag)
+            values[valid_count] = index == 0 ? IntType{} : static_cast<IntType>(IntType{1} << (index - 1));
+          else
+            values[valid_count] = static_cast<IntType>(min + static_cast<IntType>(index));
+          if (strings) {
+            string_lengths[valid_count] = commapos;
+            for (std::size_t i = 0; i < commapos; ++i)
+              strings[total_string_length + i] = str[i];
+          }
+        }
+        ++valid_count;
+        total_string_length += commapos + null_terminated;
         str += commapos + SZC(", ");
       }
     }
   }
 
 
-  template<typename E, bool NullTerminated, auto Min, std::size_t... Is>
-  constexpr auto reflect(std::index_sequence<Is...>) noexcept
-  {
-
-    constexpr auto elements_local = []() {
-      constexpr auto ArraySize = sizeof...(Is) + is_bitflag<E>;
-      using Under              = std::underlying_type_t<E>;
-      using Underlying = std::make_unsigned_t<std::conditional_t<std::is_same_v<bool, Under>, unsigned char, Under>>;
-
-
-      constexpr auto str = [](const auto dependant) {
 #if __GNUC__ <= 10
-      // GCC 10 does not have it
+  // GCC 10 does not have it
   #define CAST(type, value) static_cast<type>(value)
 #else
-      // __builtin_bit_cast used to silence errors when casting out of unscoped enums range
+  // __builtin_bit_cast used to silence errors when casting out of unscoped enums range
   #define CAST(type, value) __builtin_bit_cast(type, value)
 #endif
-        // dummy 0
-        if constexpr (sizeof(dependant) && is_bitflag<E>) // sizeof... to make contest dependant
-          return details::var_name<E{}, CAST(E, static_cast<Under>(Underlying{1} << Is))..., 0>();
-        else
-          return details::var_name<CAST(E, static_cast<Under>(static_cast<decltype(Min)>(Is) + Min))..., 0>();
-#undef CAST
-      }(0);
 
-      constexpr auto enum_in_array_len = details::enum_in_array_name_size<E{}>();
-      constexpr auto length_of_enum_in_template_array_casting = details::length_of_enum_in_template_array_if_casting<E>();
+  // the names of the values [Min, Min + sizeof...(Is))
+  template<typename E, auto Min, std::size_t... Is>
+  constexpr auto var_name_of_range(std::index_sequence<Is...>) noexcept
+  {
+    using Under = std::underlying_type_t<E>;
+    // dummy 0
+    return details::var_name<CAST(E, static_cast<Under>(static_cast<decltype(Min)>(Is) + Min))..., 0>();
+  }
+
+  // the names of `0` and every bit of the underlying type of `E`
+  template<typename E, std::size_t... Is>
+  constexpr auto var_name_of_flags(std::index_sequence<Is...>) noexcept
+  {
+    using Under      = std::underlying_type_t<E>;
+    using Underlying = std::make_unsigned_t<std::conditional_t<std::is_same_v<bool, Under>, unsigned char, Under>>;
+    // dummy 0
+    return details::var_name<E{}, CAST(E, static_cast<Under>(Underlying{1} << Is))..., 0>();
+  }
+
+  template<typename E>
+  inline constexpr std::size_t least_length_when_casting = SZC("(") +
+    details::length_of_enum_in_template_array_if_casting<E>() + SZC(")0");
+
+  template<typename E>
+  inline constexpr std::size_t least_length_when_value = details::prefix_length_or_zero<E> +
+    (details::enum_in_array_name_size<E{}>() != 0 ? details::enum_in_array_name_size<E{}>() + SZC("::") : 0);
 
-      ReflectStringReturnValue<std::underlying_type_t<E>, ArraySize> ret;
-      details::parse_string<is_bitflag<E>>(
+  // parses the `Size` values starting at `Min + First` into `ret`
+  template<typename E, bool NullTerminated, auto Min, std::size_t First, std::size_t Size, typename Ret>
+  constexpr void reflect_chunk(Ret& ret) noexcept
+  {
+    using MinT               = decltype(Min);
+    constexpr auto chunk_min = static_cast<MinT>(Min + static_cast<MinT>(First));
+    constexpr auto str       = details::var_name_of_range<E, chunk_min>(std::make_index_sequence<Size>{});
+    details::parse_string<false>(
+      /*str = */ str,
+      /*least_length_when_casting=*/least_length_when_casting<E>,
+      /*least_length_when_value=*/least_length_when_value<E>,
+      /*min = */ static_cast<std::underlying_type_t<E>>(chunk_min),
+      /*array_size = */ Size,
+      /*null_terminated= */ NullTerminated,
+      /*enum_values= */ ret.values,
+      /*string_lengths= */ ret.string_lengths,
+      /*strings= */ ret.strings,
+      /*total_string_length*/ ret.total_string_length,
+      /*valid_count*/ ret.valid_count);
+  }
+
+  // one `__PRETTY_FUNCTION__` for the whole range gets expensive for large ranges,
+  // so it is reflected `ChunkSize` values at a time.
+  template<typename E,
+           bool        NullTerminated,
+           auto        Min,
+           std::size_t Size,
+           std::size_t ChunkSize,
+           typename Ret,
+           std::size_t... Chunks>
+  constexpr void reflect_chunks(Ret& ret, std::index_sequence<Chunks...>) noexcept
+  {
+    (details::reflect_chunk<E,
+                            NullTerminated,
+                            Min,
+                            Chunks * ChunkSize,
+                            details::reflection_chunk_size(Size, Chunks, ChunkSize)>(ret),
+     ...);
+  }
+
+  template<typename E, bool NullTerminated, auto Min, std::size_t ChunkSize, typename Ret, std::size_t... Is>
+  constexpr void parse_reflection(Ret& ret, std::index_sequence<Is...>) noexcept
+  {
+    constexpr auto ArraySize = sizeof...(Is) + is_bitflag<E>;
+    if constexpr (is_bitflag<E>) {
+      // there are at most as many flags as bits so this is never chunked
+      constexpr auto str = details::var_name_of_flags<E>(std::index_sequence<Is...>{});
+      details::parse_string<true>(
         /*str = */ str,
-        /*least_length_when_casting=*/SZC("(") + length_of_enum_in_template_array_casting + SZC(")0"),
-        /*least_length_when_value=*/details::prefix_length_or_zero<E> +
-          (enum_in_array_len != 0 ? enum_in_array_len + SZC("::") : 0),
+        /*least_length_when_casting=*/least_length_when_casting<E>,
+        /*least_length_when_value=*/least_length_when_value<E>,
         /*min = */ static_cast<std::underlying_type_t<E>>(Min),
         /*array_size = */ ArraySize,
         /*null_terminated= */ NullTerminated,
@@ -207,45 +265,77 @@ namespace details {
         /*strings= */ ret.strings,
         /*total_string_length*/ ret.total_string_length,
         /*valid_count*/ ret.valid_count);
-      return ret;
-    }();
-    using Strings = std::array<char, elements_local.total_string_length>;
-
-    struct {
-      decltype(elements_local) elements;
-      Strings                  strings{};
-    } data                  = {elements_local};
-    const auto  size        = data.strings.size();
-    auto* const data_string = data.strings.data();
-    for (std::size_t i = 0; i < size; ++i)
-      data_string[i] = elements_local.strings[i];
-    return data;
+    }
+    else {
+      details::reflect_chunks<E, NullTerminated, Min, ArraySize, ChunkSize>(
+        ret, std::make_index_sequence<details::reflection_chunk_count(ArraySize, ChunkSize)>{});
+    }
   }
 
-  template<typename E, auto Min, std::size_t... Is>
-  constexpr bool is_out_of_range(std::index_sequence<Is...>) noexcept
+  template<typename E, bool NullTerminated, auto Min, std::size_t ChunkSize, std::size_t... Is>
+  constexpr auto reflect_sizes(std::index_sequence<Is...>) noexcept
   {
-    constexpr auto ArraySize = sizeof...(Is);
-    using Under              = std::underlying_type_t<E>;
+    ReflectStringSizes<std::underlying_type_t<E>> ret;
+    details::parse_reflection<E, NullTerminated, Min, ChunkSize>(ret, std::index_sequence<Is...>{});
+    return ret;
+  }
 
-#if __GNUC__ <= 10
-    // GCC 10 does not have it
-  #define CAST(type, value) static_cast<type>(value)
-#else
-    // __builtin_bit_cast used to silence errors when casting out of unscoped enums range
-  #define CAST(type, value) __builtin_bit_cast(type, value)
-#endif
-    constexpr auto str = details::var_name<CAST(E, static_cast<Under>(static_cast<decltype(Min)>(Is) + Min))..., 0>();
-#undef CAST
+  template<typename E,
+           bool        NullTerminated,
+           auto        Min,
+           std::size_t ChunkSize = ENCHANTUM_REFLECTION_CHUNK_SIZE,
+           std::size_t... Is>
+  constexpr auto reflect(std::index_sequence<Is...>) noexcept
+  {
+    constexpr auto sizes = details::reflect_sizes<E, NullTerminated, Min, ChunkSize>(std::index_sequence<Is...>{});
+
+    ReflectStringReturnValue<std::underlying_type_t<E>, sizes.valid_count, sizes.total_string_length> ret;
+    details::parse_reflection<E, NullTerminated, Min, ChunkSize>(ret, std::index_sequence<Is...>{});
+    return ret;
+  }
+
+  // `reflect` without the names, its first pass is the one `reflect<E, true, Min>` does
+  template<typename E, auto Min, std::size_t ChunkSize = ENCHANTUM_REFLECTION_CHUNK_SIZE, std::size_t... Is>
+  constexpr auto reflect_values(std::index_sequence<Is...>) noexcept
+  {
+    constexpr auto sizes = details::reflect_sizes<E, true, Min, ChunkSize>(std::index_sequence<Is...>{});
 
-    constexpr auto length_of_enum_in_template_array_casting = details::length_of_enum_in_template_array_if_casting<E>();
+    ReflectValuesReturnValue<std::underlying_type_t<E>, sizes.valid_count> ret;
+    details::parse_reflection<E, true, Min, ChunkSize>(ret, std::index_sequence<Is...>{});
+    return ret;
+  }
 
+  template<typename E, auto Min, std::size_t First, std::size_t Size>
+  constexpr bool is_out_of_range_chunk() noexcept
+  {
+    using MinT               = decltype(Min);
+    constexpr auto chunk_min = static_cast<MinT>(Min + static_cast<MinT>(First));
+    constexpr auto str       = details::var_name_of_range<E, chunk_min>(std::make_index_sequence<Size>{});
     return details::is_out_of_range_parse(
       /*str = */ str,
-      /*least_length_when_casting=*/SZC("(") + length_of_enum_in_template_array_casting + SZC(")0"),
-      /*array_size = */ ArraySize);
+      /*least_length_when_casting=*/least_length_when_casting<E>,
+      /*array_size = */ Size);
   }
 
+  template<typename E, auto Min, std::size_t Size, std::size_t... Chunks>
+  constexpr bool is_out_of_range_chunks(std::index_sequence<Chunks...>) noexcept
+  {
+    return (details::is_out_of_range_chunk<E,
+                                           Min,
+                                           Chunks * ENCHANTUM_REFLECTION_CHUNK_SIZE,
+                                           details::reflection_chunk_size(Size, Chunks)>() ||
+            ...);
+  }
+
+  template<typename E, auto Min, std::size_t... Is>
+  constexpr bool is_out_of_range(std::index_sequence<Is...>) noexcept
+  {
+    constexpr auto ArraySize = sizeof...(Is);
+    return details::is_out_of_range_chunks<E, Min, ArraySize>(
+      std::make_index_sequence<details::reflection_chunk_count(ArraySize)>{});
+  }
+
+#undef CAST
 
 } // namespace details
 
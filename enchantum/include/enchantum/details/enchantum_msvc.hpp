@@ -89,19 +89,20 @@ namespace details {
     return false;
   }
 
+  // stores what it finds in the arrays that are not null, with all of them null it only counts the names
   template<bool IsBitFlag, typename IntType>
   constexpr void parse_string(
-    const char*         str,
-    const std::size_t   least_length_when_casting,
-    const std::size_t   least_length_when_value,
-    const IntType       min,
-    const std::size_t   array_size,
-    const bool          null_terminated,
-    IntType* const      values,
-    std::uint8_t* const string_lengths,
-    char* const         strings,
-    std::size_t&        total_string_length,
-    std::size_t&        valid_count)
+    const char*        str,
+    const std::size_t  least_length_when_casting,
+    const std::size_t  least_length_when_value,
+    const IntType      min,
+    const std::size_t  array_size,
+    const bool         null_terminated,
+    IntType* const     values,
+    std::size_t* const string_lengths,
+    char* const        strings,
+    std::size_t&       total_string_length,
+    std::size_t&       valid_count)
   {
     // clang-format off
 #if ENCHANTUM_ENABLE_MSVC_SPEEDUP
@@ -145,77 +146,94 @@ namespace details {
         // although gcc implementation of std::char_traits::find is using a for loop internally
         // copying the code of the function makes it way slower to compile, this was surprising.
 
-
-        if constexpr (IsBitFlag)
-          values[valid_count] = index == 0 ? IntType{} : static_cast<IntType>(IntType{1} << (index - 1));
-        else
-          values[valid_count] = static_cast<IntType>(min + static_cast<IntType>(index));
-
         std::size_t i = 0;
         while (str[i] != ',')
-          strings[total_string_length++] = str[i++];
-        string_lengths[valid_count++] = static_cast<std::uint8_t>(i);
+          ++i;
 
-        total_string_length += null_terminated;
+        if (values) {
+          if constexpr (IsBitFlag)
+            values[valid_count] = index == 0 ? IntType{} : static_cast<IntType>(IntType{1} << (index - 1));
+          else
+            values[valid_count] = static_cast<IntType>(min + static_cast<IntType>(index));
+          if (strings) {
+            string_lengths[valid_count] = i;
+            for (std::size_t j = 0; j < i; ++j)
+              strings[total_string_length + j] = str[j];
+          }
+        }
+        ++valid_count;
+        total_string_length += i + null_terminated;
         str += i + SZC(",");
       }
     }
   }
 
-  template<typename E, bool NullTerminated, auto Min, std::size_t... Is>
-  constexpr auto reflect(std::index_sequence<Is...>) noexcept
+  template<typename E, bool NullTerminated, auto Min, typename Ret, std::size_t... Is>
+  constexpr void parse_reflection(Ret& ret, std::index_sequence<Is...>) noexcept
   {
-    constexpr auto elements_local = []() {
-      constexpr auto ArraySize = sizeof...(Is) + is_bitflag<E>;
-      using MinT               = decltype(Min);
-      using Under              = std::underlying_type_t<E>;
-      using Underlying = std::make_unsigned_t<std::conditional_t<std::is_same_v<bool, Under>, unsigned char, Under>>;
+    constexpr auto ArraySize = sizeof...(Is) + is_bitflag<E>;
+    using MinT               = decltype(Min);
+    using Under              = std::underlying_type_t<E>;
+    using Underlying = std::make_unsigned_t<std::conditional_t<std::is_same_v<bool, Under>, unsigned char, Under>>;
 
 
-      constexpr auto str = [](const auto dependant) {
-        constexpr bool always_true = sizeof(dependant) != 0;
-        // dummy 0
-        if constexpr (always_true && is_bitflag<E>) // sizeof... to make contest dependant
-          return details::var_name<static_cast<E>(!always_true), static_cast<E>(Underlying(1) << Is)..., 0>();
-        else
-          return details::var_name<static_cast<E>(static_cast<MinT>(Is) + Min)..., int(!always_true)>();
-      }(0);
-      constexpr auto type_name_len     = details::raw_type_name_func<E>().size() - 1;
-      constexpr auto enum_in_array_len = details::enum_in_array_name_size<E{}>();
+    constexpr auto str = [](const auto dependant) {
+      constexpr bool always_true = sizeof(dependant) != 0;
+      // dummy 0
+      if constexpr (always_true && is_bitflag<E>) // sizeof... to make contest dependant
+        return details::var_name<static_cast<E>(!always_true), static_cast<E>(Underlying(1) << Is)..., 0>();
+      else
+        return details::var_name<static_cast<E>(static_cast<MinT>(Is) + Min)..., int(!always_true)>();
+    }(0);
+    constexpr auto type_name_len     = details::raw_type_name_func<E>().size() - 1;
+    constexpr auto enum_in_array_len = details::enum_in_array_name_size<E{}>();
 
-      ReflectStringReturnValue<std::underlying_type_t<E>, ArraySize> ret;
-      details::parse_string<is_bitflag<E>>(
-        /*str = */ str,
+    details::parse_string<is_bitflag<E>>(
+      /*str = */ str,
 #if _MSC_VER <= 1924
-        /*least_length_when_casting=*/SZC("0x0"),
+      /*least_length_when_casting=*/SZC("0x0"),
 #else
-        /*least_length_when_casting=*/SZC("(enum ") + type_name_len + SZC(")0x0") + (sizeof(E) == 8),
+      /*least_length_when_casting=*/SZC("(enum ") + type_name_len + SZC(")0x0") + (sizeof(E) == 8),
 #endif
-        /*least_length_when_value=*/details::prefix_length_or_zero<E> +
-          (enum_in_array_len != 0 ? enum_in_array_len + SZC("::") : 0),
-        /*min = */ static_cast<std::underlying_type_t<E>>(Min),
-        /*array_size = */ ArraySize,
-        /*null_terminated= */ NullTerminated,
-        /*enum_values= */ ret.values,
-        /*string_lengths= */ ret.string_lengths,
-        /*strings= */ ret.strings,
-        /*total_string_length*/ ret.total_string_length,
-        /*valid_count*/ ret.valid_count);
-      return ret;
-    }();
+      /*least_length_when_value=*/details::prefix_length_or_zero<E> +
+        (enum_in_array_len != 0 ? enum_in_array_len + SZC("::") : 0),
+      /*min = */ static_cast<std::underlying_type_t<E>>(Min),
+      /*array_size = */ ArraySize,
+      /*null_terminated= */ NullTerminated,
+      /*enum_values= */ ret.values,
+      /*string_lengths= */ ret.string_lengths,
+      /*strings= */ ret.strings,
+      /*total_string_length*/ ret.total_string_length,
+      /*valid_count*/ ret.valid_count);
+  }
 
-    using Strings = std::array<char, elements_local.total_string_length>;
+  template<typename E, bool NullTerminated, auto Min, std::size_t... Is>
+  constexpr auto reflect_sizes(std::index_sequence<Is...>) noexcept
+  {
+    ReflectStringSizes<std::underlying_type_t<E>> ret;
+    details::parse_reflection<E, NullTerminated, Min>(ret, std::index_sequence<Is...>{});
+    return ret;
+  }
 
-    struct {
-      decltype(elements_local) elements;
-      Strings                  strings{};
-    } data = {elements_local};
+  template<typename E, bool NullTerminated, auto Min, std::size_t... Is>
+  constexpr auto reflect(std::index_sequence<Is...>) noexcept
+  {
+    constexpr auto sizes = details::reflect_sizes<E, NullTerminated, Min>(std::index_sequence<Is...>{});
+
+    ReflectStringReturnValue<std::underlying_type_t<E>, sizes.valid_count, sizes.total_string_length> ret;
+    details::parse_reflection<E, NullTerminated, Min>(ret, std::index_sequence<Is...>{});
+    return ret;
+  }
+
+  // `reflect` without the names, its first pass is the one `reflect<E, true, Min>` does
+  template<typename E, auto Min, std::size_t... Is>
+  constexpr auto reflect_values(std::index_sequence<Is...>) noexcept
+  {
+    constexpr auto sizes = details::reflect_sizes<E, true, Min>(std::index_sequence<Is...>{});
 
-    const auto  size        = data.strings.size();
-    auto* const data_string = data.strings.data();
-    for (std::size_t i = 0; i < size; ++i)
-      data_string[i] = elements_local.strings[i];
-    return data;
+    ReflectValuesReturnValue<std::underlying_type_t<E>, sizes.valid_count> ret;
+    details::parse_reflection<E, true, Min>(ret, std::index_sequence<Is...>{});
+    return ret;
   }
 
 
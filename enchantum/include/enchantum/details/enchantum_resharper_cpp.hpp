@@ -25,72 +25,75 @@ namespace details {
   }
 
 
-  template<typename E, bool NullTerminated, auto Min, std::size_t... Is>
-  constexpr auto reflect(std::index_sequence<Is...>) noexcept
+  // stores what it finds in the arrays of `ret` that are not null, with all of them null it only counts the names
+  template<typename E, bool NullTerminated, typename Ret>
+  constexpr void parse_name(Ret& ret, const std::underlying_type_t<E> value, const char* const name) noexcept
+  {
+    if (!name)
+      return;
+    const auto        str = name + prefix_length_or_zero<E>;
+    const std::size_t len = __builtin_strlen(str);
+    if (ret.values) {
+      ret.values[ret.valid_count] = value;
+      if (ret.strings) {
+        ret.string_lengths[ret.valid_count] = len;
+        for (std::size_t j = 0; j < len; ++j)
+          ret.strings[ret.total_string_length + j] = str[j];
+      }
+    }
+    ++ret.valid_count;
+    ret.total_string_length += len + (NullTerminated ? 1 : 0);
+  }
+
+  template<typename E, bool NullTerminated, auto Min, typename Ret, std::size_t... Is>
+  constexpr void parse_reflection(Ret& ret, std::index_sequence<Is...>) noexcept
   {
     using MinT = decltype(Min);
     using T    = std::underlying_type_t<E>;
     using U    = std::make_unsigned_t<std::conditional_t<std::is_same_v<bool, T>, unsigned char, T>>;
-    constexpr bool        IsBitFlag    = is_bitflag<E>;
-    constexpr std::size_t max_elements = sizeof...(Is) + IsBitFlag;
-
-    constexpr auto elements_local = [] {
-      const char* names[max_elements]{};
-      T           values[max_elements]{};
-      std::size_t count = 0;
 
-      if constexpr (IsBitFlag) {
-        if (const auto* name = __rscpp_enumerator_name(E(0))) {
-          names[count]    = name;
-          values[count++] = 0;
-        }
-
-        for (std::size_t i : {Is...}) {
-          const auto val  = T(U(1) << i);
-          const auto name = __rscpp_enumerator_name(E(val));
-          if (name) {
-            names[count]    = name;
-            values[count++] = val;
-          }
-        }
+    if constexpr (is_bitflag<E>) {
+      details::parse_name<E, NullTerminated>(ret, T(0), __rscpp_enumerator_name(E(0)));
+      for (std::size_t i : {Is...}) {
+        const auto val = T(U(1) << i);
+        details::parse_name<E, NullTerminated>(ret, val, __rscpp_enumerator_name(E(val)));
       }
-      else {
-        for (std::size_t i = 0; i < max_elements; ++i) {
-          const auto val  = T(MinT(i) + Min);
-          const auto name = __rscpp_enumerator_name(E(val));
-          if (name) {
-            names[count]    = name;
-            values[count++] = val;
-          }
-        }
+    }
+    else {
+      for (std::size_t i = 0; i < sizeof...(Is); ++i) {
+        const auto val = T(MinT(i) + Min);
+        details::parse_name<E, NullTerminated>(ret, val, __rscpp_enumerator_name(E(val)));
       }
+    }
+  }
 
-      auto ret = ReflectStringReturnValue<T, max_elements>{};
-      for (std::size_t i = 0; i < count; ++i) {
-        const auto        str = names[i] + prefix_length_or_zero<E>;
-        const std::size_t len = __builtin_strlen(str);
-        ret.values[i]         = values[i];
-        ret.string_lengths[i] = len;
-        for (std::size_t j = 0; j < len; ++j)
-          ret.strings[ret.total_string_length + j] = str[j];
-        ret.total_string_length += len + (NullTerminated ? 1 : 0);
-      }
-      ret.valid_count = count;
-      return ret;
-    }();
+  template<typename E, bool NullTerminated, auto Min, std::size_t... Is>
+  constexpr auto reflect_sizes(std::index_sequence<Is...>) noexcept
+  {
+    ReflectStringSizes<std::underlying_type_t<E>> ret;
+    details::parse_reflection<E, NullTerminated, Min>(ret, std::index_sequence<Is...>{});
+    return ret;
+  }
 
-    using Strings = std::array<char, elements_local.total_string_length>;
+  template<typename E, bool NullTerminated, auto Min, std::size_t... Is>
+  constexpr auto reflect(std::index_sequence<Is...>) noexcept
+  {
+    constexpr auto sizes = details::reflect_sizes<E, NullTerminated, Min>(std::index_sequence<Is...>{});
 
-    struct {
-      decltype(elements_local) elements;
-      Strings                  strings{};
-    } data = {elements_local};
+    ReflectStringReturnValue<std::underlying_type_t<E>, sizes.valid_count, sizes.total_string_length> ret;
+    details::parse_reflection<E, NullTerminated, Min>(ret, std::index_sequence<Is...>{});
+    return ret;
+  }
+
+  // `reflect` without the names, its first pass is the one `reflect<E, true, Min>` does
+  template<typename E, auto Min, std::size_t... Is>
+  constexpr auto reflect_values(std::index_sequence<Is...>) noexcept
+  {
+    constexpr auto sizes = details::reflect_sizes<E, true, Min>(std::index_sequence<Is...>{});
 
-    const auto size = data.strings.size();
-    const auto str  = data.strings.data();
-    for (std::size_t i = 0; i < size; ++i)
-      str[i] = elements_local.strings[i];
-    return data;
+    ReflectValuesReturnValue<std::underlying_type_t<E>, sizes.valid_count> ret;
+    details::parse_reflection<E, true, Min>(ret, std::index_sequence<Is...>{});
+    return ret;
   }
 
 } // namespace details
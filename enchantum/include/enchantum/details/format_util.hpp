@@ -2,28 +2,164 @@
 
 #include "../bitflags.hpp"
 #include "../enchantum.hpp"
-#include <string>
+#include "../type_name.hpp"
+#include "scoped_names.hpp"
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
 
 namespace enchantum {
+
+// how an enum is written as text by the formatters and `to_chars` and read by `from_chars`.
+// `scoped` prefixes names with the type name, `underlying` writes the underlying value instead of names
+// and `sep` separates the flags of bitflag enums.
+struct format_options {
+  char sep        = '|';
+  bool scoped     = false;
+  bool underlying = false;
+};
+
 namespace details {
-  template<typename E>
-  std::string format(E e) noexcept
+
+  // the format spec options are `S` for `scoped`, `d` for `underlying` and `/c` for `sep` e.g `{:S/,>20}`
+  // returns the start of the standard format spec after the enchantum options
+  // an option followed by an alignment is the fill character of the standard spec instead
+  template<typename It>
+  constexpr It parse_format_options(It it, const It end, format_options& options)
   {
-    if constexpr (is_bitflag<E>) {
-      if (const auto name = enchantum::to_string_bitflag(e); !name.empty()) {
-        if constexpr (std::is_same_v<std::string, string>) {
-          return name;
-        }
-        else {
-          return std::string(name.data(), name.size());
-        }
+    for (; it != end; ++it) {
+      const auto c = *it;
+      if (c != 'S' && c != 'd' && c != '/')
+        break;
+      const auto next = it + 1;
+      if (next != end && (*next == '<' || *next == '^' || *next == '>'))
+        break;
+      if (c == 'S') {
+        options.scoped = true;
+      }
+      else if (c == 'd') {
+        options.underlying = true;
+      }
+      else {
+        if (next == end || *next == '}')
+          break;
+        options.sep = *next;
+        ++it;
       }
     }
+    return it;
+  }
+
+  // enough characters for any value of `T` including the sign
+  template<typename T>
+  inline constexpr std::size_t max_integer_size = std::numeric_limits<T>::digits10 + 1 + std::is_signed_v<T>;
+
+  // writes the decimal digits of `value` to `out`, returns the end
+  template<typename T>
+  constexpr char* write_integer(char* out, const T value) noexcept
+  {
+    if constexpr (std::is_same_v<T, bool>) {
+      *out = value ? '1' : '0';
+      return out + 1;
+    }
     else {
-      if (const auto name = enchantum::to_string(e); !name.empty())
-        return std::string(name.data(), name.size());
+      using U = std::make_unsigned_t<T>;
+      auto u  = static_cast<U>(value);
+      if constexpr (std::is_signed_v<T>) {
+        if (value < 0) {
+          *out++ = '-';
+          u      = static_cast<U>(U{0} - u);
+        }
+      }
+      char  digits[max_integer_size<T>]{};
+      char* p = digits + sizeof(digits);
+      do {
+        *--p = static_cast<char>('0' + u % 10);
+        u    = static_cast<U>(u / 10);
+      } while (u != 0);
+      while (p != digits + sizeof(digits))
+        *out++ = *p++;
+      return out;
+    }
+  }
+
+  constexpr char* write_string(char* out, const string_view s) noexcept
+  {
+    const auto* const data = s.data();
+    for (std::size_t i = 0; i < s.size(); ++i)
+      *out++ = data[i];
+    return out;
+  }
+
+  // the longest text `format` can produce for `E`
+  template<typename E>
+  inline constexpr std::size_t max_format_size = []() {
+    constexpr auto scope = type_name<E>.size() + 2;
+    std::size_t    names = 0;
+    for (const auto name : names_generator<E>) {
+      if constexpr (is_bitflag<E>)
+        names += name.size() + scope + 1;
+      else
+        names = details::Max(names, name.size() + scope);
     }
-    return std::to_string(+enchantum::to_underlying(e)); // promote using + to select int overload if to underlying returns char
+    return details::Max(names, max_integer_size<std::underlying_type_t<E>>);
+  }();
+
+  template<typename E>
+  using format_buffer = std::array<char, max_format_size<E>>;
+
+  template<typename E>
+  constexpr char* write_name(char* const out, const std::size_t index, const bool scoped) noexcept
+  {
+    return details::write_string(out, scoped ? details::scoped_name<E>(index) : names_generator<E>[index]);
+  }
+
+  // the index of the only name of `e` if it has one, bitflags combining several flags have none
+  template<typename E>
+  constexpr optional<std::size_t> single_name_index(const E e) noexcept
+  {
+    if constexpr (is_bitflag<E>) {
+      const auto u = static_cast<std::make_unsigned_t<std::underlying_type_t<E>>>(e);
+      if ((u & (u - 1)) != 0 || (!has_zero_flag<E> && u == 0))
+        return optional<std::size_t>();
+    }
+    return enchantum::enum_to_index(e);
+  }
+
+  // writes the text of `e` to `out` which must hold `max_format_size<E>` characters, returns the end.
+  // the text is its name, the names of its flags or its underlying value if it has no name.
+  template<typename E>
+  constexpr char* format_to(char* const out, const E e, const format_options options = {}) noexcept
+  {
+    using T = std::underlying_type_t<E>;
+    if (!options.underlying) {
+      if (const auto i = details::single_name_index(e))
+        return details::write_name<E>(out, *i, options.scoped);
+
+      if constexpr (is_bitflag<E>) {
+        char*      it    = out;
+        const bool valid = details::for_each_set_flag(e, [&it, out, options](const std::size_t i) {
+          if (it != out)
+            *it++ = options.sep;
+          it = details::write_name<E>(it, i, options.scoped);
+        });
+        if (valid && it != out)
+          return it;
+      }
+    }
+    return details::write_integer(out, static_cast<T>(e));
+  }
+
+  // the text of `e` pointing to the static names when possible otherwise to `buffer` so nothing is allocated.
+  template<typename E>
+  constexpr string_view format(const E e, format_buffer<E>& buffer, const format_options options = {}) noexcept
+  {
+    if (!options.underlying)
+      if (const auto i = details::single_name_index(e))
+        return options.scoped ? details::scoped_name<E>(*i) : names_generator<E>[*i];
+    const auto size = details::format_to(buffer.data(), e, options) - buffer.data();
+    return string_view(buffer.data(), static_cast<std::size_t>(size));
   }
 } // namespace details
-} // namespace enchantum
\ No newline at end of file
+} // namespace enchantum
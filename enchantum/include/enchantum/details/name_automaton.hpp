@@ -0,0 +1,70 @@
+#pragma once
+
+#include "../common.hpp"
+#include "../entries.hpp"
+#include "name_trie.hpp"
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace enchantum {
+namespace details {
+
+  // Aho-Corasick links over `name_trie<E>`.
+  // `fail` is the node of the longest proper suffix of a node that is also in the trie,
+  // `output` is the nearest node along the `fail` chain a name ends at or 0.
+  // `root` holds the children of the root for every byte since most bytes of a text start no name.
+  template<typename Trie>
+  struct NameAutomaton {
+    using IndexType = typename Trie::IndexType;
+
+    std::array<IndexType, Trie::node_count> fail{};
+    std::array<IndexType, Trie::node_count> output{};
+    std::array<IndexType, 256>              root{};
+
+    [[nodiscard]] constexpr std::size_t next(const Trie& trie, std::size_t node, const char c) const noexcept
+    {
+      while (node != 0) {
+        if (const auto n = trie.child(node, c); n != 0)
+          return n;
+        node = fail[node];
+      }
+      return root[static_cast<unsigned char>(c)];
+    }
+  };
+
+  template<typename E>
+  constexpr auto make_name_automaton() noexcept
+  {
+    using Trie      = std::decay_t<decltype(name_trie<E>)>;
+    using IndexType = typename Trie::IndexType;
+    constexpr auto& trie = name_trie<E>;
+
+    NameAutomaton<Trie>                      ret{};
+    std::array<IndexType, Trie::node_count> queue{};
+    std::size_t                              head = 0;
+    std::size_t                              tail = 0;
+
+    for (std::size_t n = trie.first_child[0]; n != 0; n = trie.next_sibling[n]) {
+      ret.root[static_cast<unsigned char>(trie.chars[n])] = static_cast<IndexType>(n);
+      queue[tail++]                                       = static_cast<IndexType>(n);
+    }
+
+    // breadth first so the links of every shorter suffix are known
+    while (head != tail) {
+      const std::size_t node = queue[head++];
+      for (std::size_t n = trie.first_child[node]; n != 0; n = trie.next_sibling[n]) {
+        const auto f  = ret.next(trie, ret.fail[node], trie.chars[n]);
+        ret.fail[n]   = static_cast<IndexType>(f);
+        ret.output[n] = trie.terminal[f] != count<E> ? static_cast<IndexType>(f) : ret.output[f];
+        queue[tail++] = static_cast<IndexType>(n);
+      }
+    }
+    return ret;
+  }
+
+  template<typename E>
+  inline constexpr auto name_automaton = details::make_name_automaton<E>();
+
+} // namespace details
+} // namespace enchantum
@@ -0,0 +1,207 @@
+#pragma once
+
+#include "../common.hpp"
+#include "../entries.hpp"
+#include "../generators.hpp"
+#include "string_view.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// enums with fewer names than this are looked up by a linear scan which is faster for small enums
+// and does not cost anything at compile time.
+#ifndef ENCHANTUM_NAME_HASH_MIN_COUNT
+  #define ENCHANTUM_NAME_HASH_MIN_COUNT 8
+#endif
+
+namespace enchantum {
+namespace details {
+
+  constexpr char ascii_tolower(const char c) noexcept
+  {
+    return c >= 'A' && c <= 'Z' ? static_cast<char>(c + ('a' - 'A')) : c;
+  }
+
+  // FNV-1a, `Folded` hashes the ASCII lowercase of the string without copying it.
+  // wider `Char`s must be ASCII to hash the same as the narrow string
+  template<bool Folded = false, typename Char = char>
+  constexpr std::uint32_t hash_string(const Char* const data, const std::size_t size) noexcept
+  {
+    std::uint32_t h = 2166136261u;
+    for (std::size_t i = 0; i < size; ++i) {
+      if constexpr (Folded)
+        h ^= static_cast<unsigned char>(details::ascii_tolower(data[i]));
+      else
+        h ^= static_cast<unsigned char>(data[i]);
+      h *= 16777619u;
+    }
+    return h;
+  }
+
+  // murmur3 finalizer, derives the slot of a name from its hash and the displacement of its bucket
+  constexpr std::uint32_t hash_mix(std::uint32_t h, const std::uint32_t seed) noexcept
+  {
+    h ^= seed * 0x9E3779B9u;
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+    return h;
+  }
+
+  constexpr std::size_t bit_ceil(const std::size_t n) noexcept
+  {
+    std::size_t r = 1;
+    while (r < n)
+      r <<= 1;
+    return r;
+  }
+
+  // "hash and displace" perfect hash over the names of an enum.
+  // a name is hashed once, the low bits pick a bucket, and the seed stored for that bucket
+  // remaps the hash into a slot that no other name occupies.
+  template<std::size_t Count>
+  struct NameHashTable {
+    static constexpr std::size_t bucket_count = details::bit_ceil(Count) / 2 + (Count < 2);
+    static constexpr std::size_t slot_count   = details::bit_ceil(Count) * 2;
+
+    using IndexType = std::conditional_t<(Count <= UINT8_MAX),
+                                         std::uint8_t,
+                                         std::conditional_t<(Count <= UINT16_MAX), std::uint16_t, std::uint32_t>>;
+
+    std::array<std::uint16_t, bucket_count> seeds{};
+    // empty slots point to index 0 and get rejected by the final string comparison
+    std::array<IndexType, slot_count> slots{};
+    // false if two names could not be separated (e.g same name after removing `prefix_length`)
+    bool valid = false;
+
+    [[nodiscard]] constexpr std::size_t slot_of(const std::uint32_t hash) const noexcept
+    {
+      return details::hash_mix(hash, seeds[hash & (bucket_count - 1)]) & (slot_count - 1);
+    }
+  };
+
+  template<typename E, bool Folded>
+  constexpr auto make_name_hash_table() noexcept
+  {
+    constexpr auto size = count<E>;
+    using Table         = NameHashTable<size>;
+    Table ret{};
+
+    std::array<std::uint32_t, size> hashes{};
+    // names sorted by bucket so each bucket is a contiguous range in `order`
+    std::array<std::size_t, size>                    order{};
+    std::array<std::size_t, Table::bucket_count + 1> bucket_begin{};
+
+    for (std::size_t i = 0; i < size; ++i) {
+      const auto name = names_generator<E>[i];
+      hashes[i]       = details::hash_string<Folded>(name.data(), name.size());
+      ++bucket_begin[(hashes[i] & (Table::bucket_count - 1)) + 1];
+    }
+
+    std::size_t max_bucket_size = 0;
+    for (std::size_t b = 0; b < Table::bucket_count; ++b) {
+      max_bucket_size     = details::Max(max_bucket_size, bucket_begin[b + 1]);
+      bucket_begin[b + 1] = bucket_begin[b + 1] + bucket_begin[b];
+    }
+
+    {
+      auto fill = bucket_begin;
+      for (std::size_t i = 0; i < size; ++i)
+        order[fill[hashes[i] & (Table::bucket_count - 1)]++] = i;
+    }
+
+    std::array<bool, Table::slot_count> taken{};
+
+    // fullest buckets first since they are the hardest to place
+    for (auto bucket_size = max_bucket_size; bucket_size != 0; --bucket_size) {
+      for (std::size_t b = 0; b < Table::bucket_count; ++b) {
+        const auto first = bucket_begin[b];
+        const auto last  = bucket_begin[b + 1];
+        if (last - first != bucket_size)
+          continue;
+
+        // equal hashes can never be separated by any seed
+        for (auto i = first; i < last; ++i)
+          for (auto j = i + 1; j < last; ++j)
+            if (hashes[order[i]] == hashes[order[j]])
+              return ret;
+
+        for (std::uint32_t seed = 0;; ++seed) {
+          if (seed > UINT16_MAX)
+            return ret;
+          auto i = first;
+          for (; i < last; ++i) {
+            const auto slot = details::hash_mix(hashes[order[i]], seed) & (Table::slot_count - 1);
+            if (taken[slot])
+              break;
+            taken[slot]     = true;
+            ret.slots[slot] = static_cast<typename Table::IndexType>(order[i]);
+          }
+          if (i == last) {
+            ret.seeds[b] = static_cast<std::uint16_t>(seed);
+            break;
+          }
+          for (auto j = first; j < i; ++j)
+            taken[details::hash_mix(hashes[order[j]], seed) & (Table::slot_count - 1)] = false;
+        }
+      }
+    }
+    ret.valid = true;
+    return ret;
+  }
+
+  template<typename E, bool Folded = false>
+  inline constexpr auto name_hash_table = details::make_name_hash_table<E, Folded>();
+
+  template<typename E, bool Folded = false>
+  inline constexpr bool has_name_hash_table = []() {
+    if constexpr (count<E> >= ENCHANTUM_NAME_HASH_MIN_COUNT)
+      return name_hash_table<E, Folded>.valid;
+    else
+      return false;
+  }();
+
+  // returns the index of `name` in `names<E>` or `count<E>` if it is not a name of `E`
+  template<typename E>
+  [[nodiscard]] constexpr std::size_t hashed_name_index(const string_view name) noexcept
+  {
+    constexpr auto& table = name_hash_table<E>;
+    const auto      i     = table.slots[table.slot_of(details::hash_string(name.data(), name.size()))];
+    if (names_generator<E>[i] == name)
+      return i;
+    return count<E>;
+  }
+
+  // the names of `E` in ASCII lowercase, laid out exactly like `reflection_data_string_storage<E, true>`
+  template<typename E>
+  inline constexpr auto folded_name_storage = []() {
+    auto ret = reflection_data_string_storage<E, true>;
+    for (auto& c : ret)
+      c = details::ascii_tolower(c);
+    return ret;
+  }();
+
+  // same as `hashed_name_index` but ignores ASCII case
+  template<typename E>
+  [[nodiscard]] constexpr std::size_t hashed_folded_name_index(const string_view name) noexcept
+  {
+    constexpr auto&   table   = name_hash_table<E, true>;
+    const auto        size    = name.size();
+    const auto* const data    = name.data();
+    const auto        i       = table.slots[table.slot_of(details::hash_string<true>(data, size))];
+    const auto* const indices = reflection_string_indices<E, true>.data();
+    if (static_cast<std::size_t>(indices[i + 1] - indices[i] - 1) != size)
+      return count<E>;
+
+    const auto* const folded = folded_name_storage<E>.data() + indices[i];
+    for (std::size_t j = 0; j < size; ++j)
+      if (details::ascii_tolower(data[j]) != folded[j])
+        return count<E>;
+    return i;
+  }
+
+} // namespace details
+} // namespace enchantum
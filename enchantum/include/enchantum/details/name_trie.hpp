@@ -0,0 +1,134 @@
+#pragma once
+
+#include "../common.hpp"
+#include "../entries.hpp"
+#include "../generators.hpp"
+#include "sorted_names.hpp"
+#include "string_view.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace enchantum {
+namespace details {
+
+  // trie over the names of an enum stored as "first child / next sibling" arrays.
+  // node 0 is the root, since the root is never a child 0 also means "no child" and "no sibling".
+  // the children of a node are ordered by character so a lookup can stop at the first greater one.
+  template<std::size_t Count, std::size_t NodeCount>
+  struct NameTrie {
+    static constexpr std::size_t node_count = NodeCount;
+    static constexpr std::size_t max_index  = details::Max(Count, NodeCount);
+
+    using IndexType = std::conditional_t<(max_index <= UINT8_MAX),
+                                         std::uint8_t,
+                                         std::conditional_t<(max_index <= UINT16_MAX), std::uint16_t, std::uint32_t>>;
+
+    std::array<char, NodeCount>      chars{};
+    std::array<IndexType, NodeCount> first_child{};
+    std::array<IndexType, NodeCount> next_sibling{};
+    // index of the name ending at this node or `Count` if no name ends here
+    std::array<IndexType, NodeCount> terminal{};
+
+    // the child of `node` reached by `c` or 0
+    [[nodiscard]] constexpr std::size_t child(const std::size_t node, const char c) const noexcept
+    {
+      const auto uc = static_cast<unsigned char>(c);
+      for (std::size_t n = first_child[node]; n != 0; n = next_sibling[n]) {
+        const auto nc = static_cast<unsigned char>(chars[n]);
+        if (nc == uc)
+          return n;
+        if (nc > uc)
+          break;
+      }
+      return 0;
+    }
+  };
+
+  // inserting the names in sorted order means a new child always goes after the last child of its parent
+  // and an existing child can only be the last one.
+  template<typename E, std::size_t NodeCount>
+  constexpr auto make_name_trie() noexcept
+  {
+    using Trie      = NameTrie<count<E>, NodeCount>;
+    using IndexType = typename Trie::IndexType;
+    Trie                             ret{};
+    std::array<IndexType, NodeCount> last_child{};
+    std::size_t                      size = 1;
+
+    for (auto& t : ret.terminal)
+      t = static_cast<IndexType>(count<E>);
+
+    for (const auto i : sorted_name_order<E>) {
+      const auto  name = names_generator<E>[i];
+      std::size_t node = 0;
+      for (std::size_t j = 0; j < name.size(); ++j) {
+        const auto c    = name.data()[j];
+        const auto last = last_child[node];
+        if (last != 0 && ret.chars[last] == c) {
+          node = last;
+          continue;
+        }
+        const auto n = static_cast<IndexType>(size++);
+        ret.chars[n] = c;
+        if (last == 0)
+          ret.first_child[node] = n;
+        else
+          ret.next_sibling[last] = n;
+        last_child[node] = n;
+        node             = n;
+      }
+      // equal names keep the first one like `cast` does
+      if (ret.terminal[node] == count<E>)
+        ret.terminal[node] = static_cast<IndexType>(i);
+    }
+    return ret;
+  }
+
+  // every name adds a node per character after the prefix it shares with the previous name in sorted order
+  template<typename E>
+  inline constexpr std::size_t name_trie_node_count = []() {
+    std::size_t ret = 1;
+    string_view prev;
+    for (const auto i : sorted_name_order<E>) {
+      const auto  name   = names_generator<E>[i];
+      const auto  size   = details::Min(name.size(), prev.size());
+      std::size_t common = 0;
+      while (common < size && name.data()[common] == prev.data()[common])
+        ++common;
+      ret += name.size() - common;
+      prev = name;
+    }
+    return ret;
+  }();
+
+  template<typename E>
+  inline constexpr auto name_trie = details::make_name_trie<E, name_trie_node_count<E>>();
+
+  // the index of the longest name of `E` that prefixes `input` and its length, or `count<E>` if no name does.
+  template<typename E>
+  [[nodiscard]] constexpr std::pair<std::size_t, std::size_t> longest_name_prefix(const string_view input) noexcept
+  {
+    constexpr auto&   trie = name_trie<E>;
+    const auto* const data = input.data();
+    const auto        size = input.size();
+
+    std::size_t node = 0;
+    std::size_t best = count<E>;
+    std::size_t len  = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+      node = trie.child(node, data[i]);
+      if (node == 0)
+        break;
+      if (trie.terminal[node] != count<E>) {
+        best = trie.terminal[node];
+        len  = i + 1;
+      }
+    }
+    return {best, len};
+  }
+
+} // namespace details
+} // namespace enchantum
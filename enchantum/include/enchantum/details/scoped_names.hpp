@@ -0,0 +1,59 @@
+#pragma once
+
+#include "../common.hpp"
+#include "../entries.hpp"
+#include "../generators.hpp"
+#include "../type_name.hpp"
+#include "string_view.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace enchantum {
+namespace details {
+
+  // "Type::Name" for every name of an enum stored back to back with a null terminator each.
+  // name `i` is [offsets[i], offsets[i + 1] - 1) of `chars`
+  template<std::size_t Size, std::size_t Count>
+  struct ScopedNameStorage {
+    std::array<char, Size>               chars{};
+    std::array<std::uint32_t, Count + 1> offsets{};
+  };
+
+  template<typename E>
+  inline constexpr std::size_t scoped_name_storage_size = []() {
+    std::size_t ret = 0;
+    for (const auto name : names_generator<E>)
+      ret += type_name<E>.size() + 2 + name.size() + 1;
+    return ret;
+  }();
+
+  template<typename E>
+  inline constexpr auto scoped_name_storage = []() {
+    ScopedNameStorage<scoped_name_storage_size<E>, count<E>> ret{};
+    std::size_t                                              n    = 0;
+    const auto                                               copy = [&ret, &n](const string_view s) {
+      for (std::size_t i = 0; i < s.size(); ++i)
+        ret.chars[n++] = s.data()[i];
+    };
+    for (std::size_t i = 0; i < count<E>; ++i) {
+      ret.offsets[i] = static_cast<std::uint32_t>(n);
+      copy(type_name<E>);
+      copy(string_view("::", 2));
+      copy(names_generator<E>[i]);
+      ret.chars[n++] = '\0';
+    }
+    ret.offsets[count<E>] = static_cast<std::uint32_t>(n);
+    return ret;
+  }();
+
+  // the name of `values<E>[i]` qualified by its type name
+  template<typename E>
+  [[nodiscard]] constexpr string_view scoped_name(const std::size_t i) noexcept
+  {
+    constexpr auto& storage = scoped_name_storage<E>;
+    return string_view(storage.chars.data() + storage.offsets[i], storage.offsets[i + 1] - storage.offsets[i] - 1);
+  }
+
+} // namespace details
+} // namespace enchantum
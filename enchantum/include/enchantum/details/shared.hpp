@@ -17,13 +17,55 @@ namespace details {
   inline constexpr auto prefix_length_or_zero<E, decltype((void)enum_traits<E>::prefix_length)> = std::size_t{
     enum_traits<E>::prefix_length};
 
-  template<typename Underlying, std::size_t ArraySize>
+  static_assert(ENCHANTUM_REFLECTION_CHUNK_SIZE > 0, "ENCHANTUM_REFLECTION_CHUNK_SIZE must be positive");
+
+  constexpr std::size_t reflection_chunk_count(const std::size_t size,
+                                               const std::size_t chunk_size = ENCHANTUM_REFLECTION_CHUNK_SIZE) noexcept
+  {
+    return (size + chunk_size - 1) / chunk_size;
+  }
+
+  // the number of values in the `chunk`th chunk of a range of `size` values
+  constexpr std::size_t reflection_chunk_size(const std::size_t size,
+                                              const std::size_t chunk,
+                                              const std::size_t chunk_size = ENCHANTUM_REFLECTION_CHUNK_SIZE) noexcept
+  {
+    const auto rest = size - chunk * chunk_size;
+    return rest < chunk_size ? rest : chunk_size;
+  }
+
+  // names are read up to the next separator whatever their length
+  inline constexpr std::size_t unbounded_name_length = static_cast<std::size_t>(-1);
+
+  // the first of the two passes over the reflected string only counts the names and their characters
+  // so the second pass can store them in a `ReflectStringReturnValue` of the exact size.
+  // the null pointers tell `parse_string` not to store anything
+  template<typename Underlying>
+  struct ReflectStringSizes {
+    static constexpr Underlying*  values              = nullptr;
+    static constexpr std::size_t* string_lengths      = nullptr;
+    static constexpr char*        strings             = nullptr;
+    std::size_t                   total_string_length = 0;
+    std::size_t                   valid_count         = 0;
+  };
+
+  // the values found by a backend without their names, the null pointers tell `parse_string` not to store names
+  template<typename Underlying, std::size_t Count>
+  struct ReflectValuesReturnValue {
+    Underlying                    values[Count + (Count == 0)]{};
+    static constexpr std::size_t* string_lengths      = nullptr;
+    static constexpr char*        strings             = nullptr;
+    std::size_t                   total_string_length = 0;
+    std::size_t                   valid_count         = 0;
+  };
+
+  // the values and names found by a backend, `Count` names taking `StringsSize` characters
+  template<typename Underlying, std::size_t Count, std::size_t StringsSize>
   struct ReflectStringReturnValue {
-    Underlying   values[ArraySize]{};
-    std::uint8_t string_lengths[ArraySize]{};
-    // the sum of all character names must be less than the size of this array
-    // no one will likely hit this unless you for some odd reason have extremely long names
-    char        strings[1024 * 8]{};
+    // never zero sized since C arrays can not be
+    Underlying  values[Count + (Count == 0)]{};
+    std::size_t string_lengths[Count + (Count == 0)]{};
+    char        strings[StringsSize + (StringsSize == 0)]{};
     std::size_t total_string_length = 0;
     std::size_t valid_count         = 0;
   };
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "../common.hpp"
+#include "../entries.hpp"
+#include "../generators.hpp"
+#include "string_view.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace enchantum {
+namespace details {
+
+  // lexicographical comparison of bytes as `unsigned char` like `std::char_traits<char>::compare`
+  // only `data()` and `size()` are used to support custom string views
+  constexpr int compare_names(const string_view a, const string_view b) noexcept
+  {
+    const auto a_size = a.size();
+    const auto b_size = b.size();
+    const auto size   = a_size < b_size ? a_size : b_size;
+    const auto a_data = a.data();
+    const auto b_data = b.data();
+    for (std::size_t i = 0; i < size; ++i) {
+      const auto x = static_cast<unsigned char>(a_data[i]);
+      const auto y = static_cast<unsigned char>(b_data[i]);
+      if (x != y)
+        return x < y ? -1 : 1;
+    }
+    return a_size == b_size ? 0 : (a_size < b_size ? -1 : 1);
+  }
+
+  // compares only the first `prefix.size()` characters of `name`
+  constexpr int compare_name_prefix(const string_view name, const string_view prefix) noexcept
+  {
+    const auto size = prefix.size();
+    if (name.size() <= size)
+      return details::compare_names(name, prefix);
+    return details::compare_names(string_view(name.data(), size), prefix);
+  }
+
+  // permutation of the indices of `names<E>` sorting them, equal names keep their relative order
+  template<typename E>
+  constexpr auto make_sorted_name_order() noexcept
+  {
+    constexpr auto size = count<E>;
+    using IndexType     = std::conditional_t<(size <= UINT8_MAX),
+                                         std::uint8_t,
+                                         std::conditional_t<(size <= UINT16_MAX), std::uint16_t, std::uint32_t>>;
+
+    std::array<IndexType, size> order{};
+    std::array<IndexType, size> buffer{};
+    for (std::size_t i = 0; i < size; ++i)
+      order[i] = static_cast<IndexType>(i);
+
+    // bottom up merge sort, insertion sort would be quadratic in constant evaluation steps
+    for (std::size_t width = 1; width < size; width *= 2) {
+      for (std::size_t first = 0; first < size; first += 2 * width) {
+        const auto middle = details::Min(first + width, size);
+        const auto last   = details::Min(first + 2 * width, size);
+
+        auto l = first;
+        auto r = middle;
+        auto o = first;
+        while (l < middle && r < last) {
+          if (details::compare_names(names_generator<E>[order[r]], names_generator<E>[order[l]]) < 0)
+            buffer[o++] = order[r++];
+          else
+            buffer[o++] = order[l++];
+        }
+        while (l < middle)
+          buffer[o++] = order[l++];
+        while (r < last)
+          buffer[o++] = order[r++];
+      }
+      order = buffer;
+    }
+    return order;
+  }
+
+  template<typename E>
+  inline constexpr auto sorted_name_order = details::make_sorted_name_order<E>();
+
+  // first position in `sorted_name_order<E>` whose name is not less than `name`
+  // when `PrefixOnly` is true only the first `name.size()` characters of every name are compared
+  // which makes the returned position the first after all names starting with `name`
+  template<typename E, bool UpperBound = false, bool PrefixOnly = false>
+  [[nodiscard]] constexpr std::size_t sorted_name_bound(const string_view name) noexcept
+  {
+    std::size_t first = 0;
+    std::size_t size  = count<E>;
+    while (size != 0) {
+      const auto half = size / 2;
+      const auto s    = names_generator<E>[sorted_name_order<E>[first + half]];
+      const auto cmp  = PrefixOnly ? details::compare_name_prefix(s, name) : details::compare_names(s, name);
+      if (UpperBound ? cmp <= 0 : cmp < 0) {
+        first += half + 1;
+        size -= half + 1;
+      }
+      else {
+        size = half;
+      }
+    }
+    return first;
+  }
+
+  // returns the index of `name` in `names<E>` or `count<E>` if it is not a name of `E`
+  template<typename E>
+  [[nodiscard]] constexpr std::size_t sorted_name_index(const string_view name) noexcept
+  {
+    const auto pos = details::sorted_name_bound<E>(name);
+    if (pos != count<E>) {
+      const auto i = sorted_name_order<E>[pos];
+      if (names_generator<E>[i] == name)
+        return i;
+    }
+    return count<E>;
+  }
+
+} // namespace details
+} // namespace enchantum
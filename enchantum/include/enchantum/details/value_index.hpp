@@ -0,0 +1,212 @@
+#pragma once
+
+#include "../common.hpp"
+#include "../entries.hpp"
+#include "../generators.hpp"
+#include "countr_zero.hpp"
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// non contiguous enums whose values span at most this many integers get a table from value to index
+// making `enum_to_index`, `to_string` and `contains` O(1), wider enums get a binary search.
+// `enum_traits<E>::index_lookup` overrides it.
+#ifndef ENCHANTUM_DENSE_INDEX_MAX_SPAN
+  #define ENCHANTUM_DENSE_INDEX_MAX_SPAN 1024
+#endif
+
+namespace enchantum {
+namespace details {
+
+  template<typename E>
+  using unsigned_underlying_type_t = std::make_unsigned_t<
+    std::conditional_t<std::is_same_v<std::underlying_type_t<E>, bool>, unsigned char, std::underlying_type_t<E>>>;
+
+  template<typename E>
+  using value_index_type_t = std::conditional_t<(count<E> <= UINT8_MAX),
+                                                std::uint8_t,
+                                                std::conditional_t<(count<E> <= UINT16_MAX), std::uint16_t, std::uint32_t>>;
+
+  // the distance of `value` from `min<E>`, `value` must be in [min<E>, max<E>]
+  template<typename E>
+  constexpr std::size_t value_offset(const std::underlying_type_t<E> value) noexcept
+  {
+    using U = unsigned_underlying_type_t<E>;
+    return static_cast<std::size_t>(
+      static_cast<U>(static_cast<U>(value) - static_cast<U>(static_cast<std::underlying_type_t<E>>(min<E>))));
+  }
+
+  // the amount of integers in [min<E>, max<E>], saturated to SIZE_MAX
+  template<typename E>
+  inline constexpr std::size_t value_span = []() {
+    if constexpr (count<E> == 0) {
+      return std::size_t{0};
+    }
+    else {
+      const auto distance = details::value_offset<E>(static_cast<std::underlying_type_t<E>>(max<E>));
+      return distance == SIZE_MAX ? SIZE_MAX : distance + 1;
+    }
+  }();
+
+  // see `benchmarks/value_index.cpp`, eytzinger wins from a handful of values unless the compiler
+  // vectorizes `packed_scan` which then wins for a few dozens of values.
+  template<typename E, typename = void>
+  inline constexpr index_lookup_strategy index_lookup_of = []() {
+    if (count<E> != 0 && value_span<E> <= ENCHANTUM_DENSE_INDEX_MAX_SPAN)
+      return index_lookup_strategy::dense_table;
+    return count<E> > 8 ? index_lookup_strategy::eytzinger : index_lookup_strategy::linear;
+  }();
+
+  template<typename E>
+  inline constexpr index_lookup_strategy index_lookup_of<E, decltype((void)enum_traits<E>::index_lookup)> =
+    enum_traits<E>::index_lookup;
+
+  // index in `values<E>` of every value in [min<E>, max<E>] or `count<E>` for the holes
+  template<typename E>
+  inline constexpr auto dense_index_table = []() {
+    using IndexType = value_index_type_t<E>;
+    std::array<IndexType, value_span<E>> ret{};
+    for (auto& i : ret)
+      i = static_cast<IndexType>(count<E>);
+    for (std::size_t i = 0; i < count<E>; ++i)
+      ret[details::value_offset<E>(static_cast<std::underlying_type_t<E>>(values_generator<E>[i]))] =
+        static_cast<IndexType>(i);
+    return ret;
+  }();
+
+  // bit `value_offset<E>(value)` is set for every value of `E`
+  template<typename E>
+  inline constexpr auto dense_value_bitmap = []() {
+    std::array<unsigned char, (value_span<E> + CHAR_BIT - 1) / CHAR_BIT> ret{};
+    for (std::size_t i = 0; i < count<E>; ++i) {
+      const auto offset = details::value_offset<E>(static_cast<std::underlying_type_t<E>>(values_generator<E>[i]));
+      ret[offset / CHAR_BIT] = static_cast<unsigned char>(ret[offset / CHAR_BIT] | (1u << (offset % CHAR_BIT)));
+    }
+    return ret;
+  }();
+
+  template<typename E>
+  struct SortedValues {
+    std::array<std::underlying_type_t<E>, count<E>> values{};
+    std::array<value_index_type_t<E>, count<E>>     indices{};
+  };
+
+  // `values<E>` is already sorted so insertion sort is linear, it only guards against a backend that is not
+  template<typename E>
+  inline constexpr auto sorted_values = []() {
+    using T = std::underlying_type_t<E>;
+    SortedValues<E> ret{};
+    for (std::size_t i = 0; i < count<E>; ++i) {
+      const auto  value = static_cast<T>(values_generator<E>[i]);
+      std::size_t j     = i;
+      for (; j != 0 && value < ret.values[j - 1]; --j) {
+        ret.values[j]  = ret.values[j - 1];
+        ret.indices[j] = ret.indices[j - 1];
+      }
+      ret.values[j]  = value;
+      ret.indices[j] = static_cast<value_index_type_t<E>>(i);
+    }
+    return ret;
+  }();
+
+  // `sorted_values<E>` in breadth first order of the implicit binary search tree rooted at 1,
+  // the top levels of the tree share cache lines which a plain binary search does not do.
+  template<typename E>
+  inline constexpr auto eytzinger_values = []() {
+    struct {
+      std::array<std::underlying_type_t<E>, count<E> + 1> values{};
+      std::array<value_index_type_t<E>, count<E> + 1>     indices{};
+    } ret{};
+    std::size_t next = 0;
+    // in order traversal of the tree visits the sorted values in order
+    std::size_t k = 1;
+    while (k * 2 <= count<E>)
+      k *= 2;
+    for (std::size_t i = 0; i < count<E>; ++i) {
+      ret.values[k]  = sorted_values<E>.values[next];
+      ret.indices[k] = sorted_values<E>.indices[next];
+      ++next;
+      // in order successor of k
+      if (k * 2 + 1 <= count<E>) {
+        k = k * 2 + 1;
+        while (k * 2 <= count<E>)
+          k *= 2;
+      }
+      else {
+        while (k & 1)
+          k >>= 1;
+        k >>= 1;
+      }
+    }
+    return ret;
+  }();
+
+  // the index of `value` in `values<E>` or `count<E>` if it is not a value of `E`
+  template<typename E>
+  [[nodiscard]] constexpr std::size_t value_to_index(const std::underlying_type_t<E> value) noexcept
+  {
+    using T               = std::underlying_type_t<E>;
+    constexpr auto lookup = index_lookup_of<E>;
+    if constexpr (lookup == index_lookup_strategy::dense_table) {
+      if (value < static_cast<T>(min<E>) || value > static_cast<T>(max<E>))
+        return count<E>;
+      return dense_index_table<E>[details::value_offset<E>(value)];
+    }
+    else if constexpr (lookup == index_lookup_strategy::binary_search) {
+      constexpr auto& sorted = sorted_values<E>;
+      std::size_t     first  = 0;
+      std::size_t     size   = count<E>;
+      while (size > 1) {
+        const auto half = size / 2;
+        first           = sorted.values[first + half] <= value ? first + half : first;
+        size -= half;
+      }
+      return sorted.values[first] == value ? std::size_t{sorted.indices[first]} : count<E>;
+    }
+    else if constexpr (lookup == index_lookup_strategy::eytzinger) {
+      constexpr auto& tree = eytzinger_values<E>;
+      std::size_t     k    = 1;
+      while (k <= count<E>)
+        k = 2 * k + (tree.values[k] < value);
+      // drop the trailing right turns and the last left turn to get the first value not less than `value`
+      k >>= details::countr_zero(~k) + 1;
+      return k != 0 && tree.values[k] == value ? std::size_t{tree.indices[k]} : count<E>;
+    }
+    else if constexpr (lookup == index_lookup_strategy::packed_scan) {
+      constexpr auto& sorted = sorted_values<E>;
+      std::size_t     less   = 0;
+      for (std::size_t i = 0; i < count<E>; ++i)
+        less += sorted.values[i] < value;
+      return less != count<E> && sorted.values[less] == value ? std::size_t{sorted.indices[less]} : count<E>;
+    }
+    else {
+      for (std::size_t i = 0; i < count<E>; ++i)
+        if (static_cast<T>(values_generator<E>[i]) == value)
+          return i;
+      return count<E>;
+    }
+  }
+
+  // `value` must be in [min<E>, max<E>]
+  template<typename E>
+  [[nodiscard]] constexpr bool has_value_in_range(const std::underlying_type_t<E> value) noexcept
+  {
+    if constexpr (index_lookup_of<E> == index_lookup_strategy::dense_table) {
+      const auto offset = details::value_offset<E>(value);
+      return (dense_value_bitmap<E>[offset / CHAR_BIT] >> (offset % CHAR_BIT)) & 1u;
+    }
+    else if constexpr (index_lookup_of<E> == index_lookup_strategy::linear) {
+      for (const auto v : values_generator<E>)
+        if (static_cast<std::underlying_type_t<E>>(v) == value)
+          return true;
+      return false;
+    }
+    else {
+      return details::value_to_index<E>(value) != count<E>;
+    }
+  }
+
+} // namespace details
+} // namespace enchantum
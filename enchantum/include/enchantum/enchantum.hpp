@@ -9,6 +9,11 @@
 #include "type_name.hpp"           // IWYU pragma: export
 // IWYU pragma: end_exports
 
+#include "details/char_names.hpp"
+#include "details/name_hash.hpp"
+#include "details/sorted_names.hpp"
+#include "details/value_index.hpp"
+#include <string_view>
 #include <type_traits>
 #include <utility>
 
@@ -44,6 +49,25 @@ namespace details {
     }
   }
 
+  struct ascii_case_insensitive_t {
+    [[nodiscard]] constexpr bool operator()(const char a, const char b) const noexcept
+    {
+      return details::ascii_tolower(a) == details::ascii_tolower(b);
+    }
+  };
+
+  template<typename E, typename BinaryPredicate>
+  inline constexpr bool uses_folded_name_hash = false;
+
+  template<typename E>
+  inline constexpr bool uses_folded_name_hash<E, ascii_case_insensitive_t> = []() {
+    // the names of an extern enum are compared one by one through `extern_reflection`
+    if constexpr (has_extern_reflection<E>)
+      return false;
+    else
+      return has_name_hash_table<E, true>;
+  }();
+
   constexpr std::pair<std::size_t, std::size_t> minmax_string_size(const string_view* begin, const string_view* const end)
   {
     using T     = std::size_t;
@@ -59,6 +83,10 @@ namespace details {
 
 } // namespace details
 
+// A `BinaryPredicate` comparing names ignoring ASCII case.
+// `cast` and `contains` recognize it and look up the input in precomputed lowercase names
+// instead of calling it for every character of every name.
+inline constexpr details::ascii_case_insensitive_t ascii_case_insensitive{};
 
 template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
 [[nodiscard]] constexpr bool contains(const std::underlying_type_t<E> value) noexcept
@@ -81,10 +109,7 @@ template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
     return true;
   }
   else {
-    for (const auto v : values_generator<E>)
-      if (static_cast<T>(v) == value)
-        return true;
-    return false;
+    return details::has_value_in_range<E>(value);
   }
 }
 
@@ -94,27 +119,108 @@ template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
   return enchantum::contains<E>(static_cast<std::underlying_type_t<E>>(value));
 }
 
+namespace details {
+  // specialized by `ENCHANTUM_EXTERN_REFLECTION`, the names are then looked up by these functions defined
+  // by `ENCHANTUM_DEFINE_REFLECTION` in a single translation unit instead of evaluating the name tables everywhere.
+  //   static string_view name(std::size_t index) noexcept;
+  //   static std::size_t name_to_index(string_view name) noexcept;
+  template<typename E>
+  struct extern_reflection;
+
+  // returns the index of `name` in `names<E>` or `count<E>` if it is not a name of `E`
+  template<typename E>
+  [[nodiscard]] constexpr std::size_t name_to_index(const string_view name) noexcept
+  {
+    constexpr auto minmax = details::minmax_string_size(names<E>.data(), names<E>.data() + names<E>.size());
+    if (const auto size = name.size(); size < minmax.first || size > minmax.second)
+      return count<E>;
+
+    if constexpr (details::has_name_hash_table<E>) {
+      return details::hashed_name_index<E>(name);
+    }
+    else if constexpr (count<E> >= ENCHANTUM_NAME_HASH_MIN_COUNT) {
+      // names that can not be hashed apart are still found in O(log n)
+      return details::sorted_name_index<E>(name);
+    }
+    else {
+      for (std::size_t i = 0; i < count<E>; ++i)
+        if (names_generator<E>[i] == name)
+          return i;
+      return count<E>;
+    }
+  }
+
+  // same as `name_to_index` for the names of `E` transcoded to `CharT`
+  template<typename E, typename CharT>
+  [[nodiscard]] constexpr std::size_t char_name_to_index(const std::basic_string_view<CharT> name) noexcept
+  {
+    constexpr auto& storage = char_name_storage<E, CharT>;
+    const auto      size    = name.size();
+    if (size < storage.min_size || size > storage.max_size)
+      return count<E>;
+
+    if constexpr (storage.ascii && details::has_name_hash_table<E>) {
+      // ASCII hashes the same in every character type so the table of the narrow names is reused
+      const auto* const data = name.data();
+      for (std::size_t j = 0; j < size; ++j)
+        if (static_cast<std::make_unsigned_t<CharT>>(data[j]) >= 0x80)
+          return count<E>;
+
+      constexpr auto& table = name_hash_table<E>;
+      const auto      i     = table.slots[table.slot_of(details::hash_string(data, size))];
+      if (details::char_name<E, CharT>(i) == name)
+        return i;
+      return count<E>;
+    }
+    else {
+      for (std::size_t i = 0; i < count<E>; ++i)
+        if (details::char_name<E, CharT>(i) == name)
+          return i;
+      return count<E>;
+    }
+  }
+} // namespace details
+
+namespace details {
+  template<typename E>
+  [[nodiscard]] constexpr std::size_t name_index_of(const string_view name) noexcept
+  {
+    if constexpr (has_extern_reflection<E>)
+      return extern_reflection<E>::name_to_index(name);
+    else
+      return details::name_to_index<E>(name);
+  }
+
+  template<typename E>
+  [[nodiscard]] constexpr string_view name_at(const std::size_t index) noexcept
+  {
+    if constexpr (has_extern_reflection<E>)
+      return extern_reflection<E>::name(index);
+    else
+      return names_generator<E>[index];
+  }
+} // namespace details
+
 template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
 [[nodiscard]] constexpr bool contains(const string_view name) noexcept
 {
-  constexpr auto minmax = details::minmax_string_size(names<E>.data(), names<E>.data() + names<E>.size());
-  if (const auto size = name.size(); size < minmax.first || size > minmax.second)
-    return false;
-
-  for (const auto s : names_generator<E>)
-    if (s == name)
-      return true;
-  return false;
+  return details::name_index_of<E>(name) != count<E>;
 }
 
 
 template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E), typename BinaryPred>
 [[nodiscard]] constexpr bool contains(const string_view name, const BinaryPred binary_pred) noexcept
 {
-  for (const auto s : names_generator<E>)
-    if (details::call_predicate(binary_pred, name, s))
-      return true;
-  return false;
+  if constexpr (details::uses_folded_name_hash<E, BinaryPred>) {
+    (void)binary_pred;
+    return details::hashed_folded_name_index<E>(name) != count<E>;
+  }
+  else {
+    for (std::size_t i = 0; i < count<E>; ++i)
+      if (details::call_predicate(binary_pred, name, details::name_at<E>(i)))
+        return true;
+    return false;
+  }
 }
 
 
@@ -129,39 +235,62 @@ namespace details {
     }
   };
 
+  // the index of `e` in `values<E>`, `e` must be a value of `E`
+  template<typename E>
+  [[nodiscard]] constexpr std::size_t member_index(const E e) noexcept
+  {
+    using T = std::underlying_type_t<E>;
+
+    if constexpr (count<E> == 0) {
+      (void)e;
+      return 0;
+    }
+    else if constexpr (is_contiguous<E>) {
+      return details::value_offset<E>(static_cast<T>(e));
+    }
+    else if constexpr (is_contiguous_bitflag<E>) {
+      constexpr bool has_zero = has_zero_flag<E>;
+      if constexpr (has_zero)
+        if (static_cast<T>(e) == 0)
+          return 0; // assumes 0 is the index of value `0`
+
+      using U = std::make_unsigned_t<T>;
+      return static_cast<std::size_t>(has_zero + details::countr_zero(static_cast<U>(e)) -
+                                      details::countr_zero(static_cast<U>(values_generator<E>[has_zero])));
+    }
+    else if constexpr (index_lookup_of<E> == index_lookup_strategy::dense_table) {
+      return dense_index_table<E>[details::value_offset<E>(static_cast<T>(e))];
+    }
+    else {
+      return details::value_to_index<E>(static_cast<T>(e));
+    }
+  }
+
   struct enum_to_index_functor {
     template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
     [[nodiscard]] constexpr optional<std::size_t> operator()(const E e) const noexcept
     {
-      using T = std::underlying_type_t<E>;
-
-      if constexpr (is_contiguous<E> && count<E> != 0) {
-        if (enchantum::contains(e)) {
-          return optional<std::size_t>(std::size_t(T(e) - T(min<E>)));
-        }
-      }
-      else if constexpr (is_contiguous_bitflag<E>) {
-        if (enchantum::contains(e)) {
-          constexpr bool has_zero = has_zero_flag<E>;
-          if constexpr (has_zero)
-            if (static_cast<T>(e) == 0)
-              return optional<std::size_t>(0); // assumes 0 is the index of value `0`
-
-          using U = std::make_unsigned_t<T>;
-          return has_zero + details::countr_zero(static_cast<U>(e)) -
-            details::countr_zero(static_cast<U>(values_generator<E>[has_zero]));
-        }
+      if constexpr (count<E> != 0 && (is_contiguous<E> || is_contiguous_bitflag<E>)) {
+        if (enchantum::contains(e))
+          return optional<std::size_t>(details::member_index(e));
       }
       else {
-        for (std::size_t i = 0; i < count<E>; ++i) {
-          if (values_generator<E>[i] == e)
-            return optional<std::size_t>(i);
-        }
+        if (const auto i = details::value_to_index<E>(static_cast<std::underlying_type_t<E>>(e)); i != count<E>)
+          return optional<std::size_t>(i);
       }
       return optional<std::size_t>();
     }
   };
 
+  struct enum_to_index_unchecked_functor {
+    template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
+    [[nodiscard]] constexpr std::size_t operator()(const E e) const noexcept
+    {
+      ENCHANTUM_ASSUME(enchantum::contains(e));
+      return details::member_index(e);
+    }
+  };
+
 
   template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
   struct cast_functor {
@@ -174,29 +303,59 @@ namespace details {
 
     [[nodiscard]] constexpr optional<E> operator()(const string_view name) const noexcept
     {
-      constexpr auto minmax = details::minmax_string_size(names<E>.data(), names<E>.data() + names<E>.size());
-      if (const auto size = name.size(); size < minmax.first || size > minmax.second)
-        return optional<E>(); // nullopt
-
-      for (std::size_t i = 0; i < count<E>; ++i) {
-        if (names_generator<E>[i] == name) {
-          return optional<E>(values_generator<E>[i]);
-        }
-      }
+      if (const auto i = details::name_index_of<E>(name); i != count<E>)
+        return optional<E>(values_generator<E>[i]);
       return optional<E>(); // nullopt
     }
 
+    [[nodiscard]] constexpr optional<E> operator()(const std::wstring_view name) const noexcept
+    {
+      return cast_char_name(name);
+    }
+
+#ifdef __cpp_char8_t
+    [[nodiscard]] constexpr optional<E> operator()(const std::u8string_view name) const noexcept
+    {
+      return cast_char_name(name);
+    }
+#endif
+
+    [[nodiscard]] constexpr optional<E> operator()(const std::u16string_view name) const noexcept
+    {
+      return cast_char_name(name);
+    }
+
+    [[nodiscard]] constexpr optional<E> operator()(const std::u32string_view name) const noexcept
+    {
+      return cast_char_name(name);
+    }
+
     template<typename BinaryPred>
     [[nodiscard]] constexpr optional<E> operator()(const string_view name, const BinaryPred binary_pred) const noexcept
     {
-
-      for (std::size_t i = 0; i < count<E>; ++i) {
-        if (details::call_predicate(binary_pred, name, names_generator<E>[i])) {
+      if constexpr (details::uses_folded_name_hash<E, BinaryPred>) {
+        (void)binary_pred;
+        if (const auto i = details::hashed_folded_name_index<E>(name); i != count<E>)
           return optional<E>(values_generator<E>[i]);
+      }
+      else {
+        for (std::size_t i = 0; i < count<E>; ++i) {
+          if (details::call_predicate(binary_pred, name, details::name_at<E>(i))) {
+            return optional<E>(values_generator<E>[i]);
+          }
         }
       }
       return optional<E>();
     }
+
+  private:
+    template<typename CharT>
+    [[nodiscard]] static constexpr optional<E> cast_char_name(const std::basic_string_view<CharT> name) noexcept
+    {
+      if (const auto i = details::char_name_to_index<E, CharT>(name); i != count<E>)
+        return optional<E>(values_generator<E>[i]);
+      return optional<E>();
+    }
   };
 
 } // namespace details
@@ -206,6 +365,9 @@ inline constexpr details::index_to_enum_functor<E> index_to_enum{};
 
 inline constexpr details::enum_to_index_functor enum_to_index{};
 
+// same as `enum_to_index` but `e` must be a value of `E`, checked by `ENCHANTUM_ASSUME`
+inline constexpr details::enum_to_index_unchecked_functor enum_to_index_unchecked{};
+
 template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
 inline constexpr details::cast_functor<E> cast{};
 
@@ -216,14 +378,71 @@ namespace details {
     [[nodiscard]] constexpr string_view operator()(const E value) const noexcept
     {
       if (const auto i = enchantum::enum_to_index(value))
-        return names_generator<E>[*i];
+        return details::name_at<E>(*i);
       return string_view();
     }
   };
 
+  struct to_string_unchecked_functor {
+    template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
+    [[nodiscard]] constexpr string_view operator()(const E value) const noexcept
+    {
+      return details::name_at<E>(enchantum::enum_to_index_unchecked(value));
+    }
+  };
+
+  template<typename CharT>
+  struct to_char_string_functor {
+    template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
+    [[nodiscard]] constexpr std::basic_string_view<CharT> operator()(const E value) const noexcept
+    {
+      if (const auto i = enchantum::enum_to_index(value))
+        return details::char_name<E, CharT>(*i);
+      return std::basic_string_view<CharT>();
+    }
+  };
+
 } // namespace details
 inline constexpr details::to_string_functor to_string{};
 
+// same as `to_string` but the names are transcoded to `wchar_t`, `char8_t`, `char16_t` or `char32_t` at compile time
+inline constexpr details::to_char_string_functor<wchar_t> to_wstring{};
+#ifdef __cpp_char8_t
+inline constexpr details::to_char_string_functor<char8_t> to_u8string{};
+#endif
+inline constexpr details::to_char_string_functor<char16_t> to_u16string{};
+inline constexpr details::to_char_string_functor<char32_t> to_u32string{};
+
+// same as `to_string` but `value` must be a value of `E`, checked by `ENCHANTUM_ASSUME`
+inline constexpr details::to_string_unchecked_functor to_string_unchecked{};
+
+// `ENCHANTUM_EXTERN_REFLECTION(Enum);` in a header makes `to_string`, `to_string_unchecked`, `cast`, `contains`,
+// `cast_batch` and the bitflag functions look the names up in the translation unit having
+// `ENCHANTUM_DEFINE_REFLECTION(Enum)` so they are not usable in constant expressions there.
+// values, `count`, `min` and `max` stay compile time constants, everything else needing the names fails to compile.
+// `ENCHANTUM_DEFINE_REFLECTION` must come before any use of the names in its translation unit.
+#define ENCHANTUM_EXTERN_REFLECTION(ENUM)                                                           \
+  template<>                                                                                        \
+  inline constexpr bool enchantum::details::has_extern_reflection<ENUM> = true;                     \
+  template<>                                                                                        \
+  struct enchantum::details::extern_reflection<ENUM> {                                              \
+    static ::enchantum::string_view name(::std::size_t index) noexcept;                             \
+    static ::std::size_t            name_to_index(::enchantum::string_view name) noexcept;          \
+  }
+
+#define ENCHANTUM_DEFINE_REFLECTION(ENUM)                                                                        \
+  template<>                                                                                                     \
+  inline constexpr bool enchantum::details::defines_extern_reflection<ENUM> = true;                              \
+  ::enchantum::string_view enchantum::details::extern_reflection<ENUM>::name(const ::std::size_t index) noexcept \
+  {                                                                                                              \
+    return ::enchantum::names_generator<ENUM>[index];                                                            \
+  }                                                                                                              \
+  ::std::size_t enchantum::details::extern_reflection<ENUM>::name_to_index(                                      \
+    const ::enchantum::string_view name) noexcept                                                                \
+  {                                                                                                              \
+    return ::enchantum::details::name_to_index<ENUM>(name);                                                      \
+  }
+
 
 } // namespace enchantum
 
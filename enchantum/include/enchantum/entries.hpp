@@ -18,12 +18,19 @@
 #include "common.hpp"
 #include <array>
 #include <climits>
+#include <cstdint>
 #include <type_traits>
 #include <utility>
 
 #ifndef ENCHANTUM_CHECK_OUT_OF_BOUNDS_BY
   #define ENCHANTUM_CHECK_OUT_OF_BOUNDS_BY 2
 #endif
+// opt-in, enums without `enum_traits` probe their range in blocks of this many values
+// and only parse the span of the blocks having values, 0 parses the whole range.
+// probing still instantiates the whole range so it only helps enums whose members cluster at one end of it
+#ifndef ENCHANTUM_DISCOVER_RANGE_BLOCK_SIZE
+  #define ENCHANTUM_DISCOVER_RANGE_BLOCK_SIZE 0
+#endif
 #if ENCHANTUM_CHECK_OUT_OF_BOUNDS_BY < 0
   #error ENCHANTUM_CHECK_OUT_OF_BOUNDS_BY must not be a negative number.
 #endif
@@ -39,6 +46,10 @@ template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
 }
 #endif
 
+// set to `true` next to a specialization of `entries<E>` so every other variable and function
+// is synthesized from it instead of reflecting `E`
+template<typename E>
+inline constexpr bool has_specialized_entries = false;
 
 namespace details {
 
@@ -74,20 +85,210 @@ namespace details {
     std::array<StringLengthType, Size + 1> string_indices{};
   };
 
-  template<typename E, bool NullTerminated, auto Min = enum_traits<E>::min, decltype(Min) Max = enum_traits<E>::max>
-  inline constexpr auto reflection_data_impl = details::reflect<E, NullTerminated, Min>(
-    std::make_index_sequence<details::get_index_sequence_max(is_bitflag<E>,
-                                                             has_fixed_underlying_type<E>,
-                                                             sizeof(E),
-                                                             Min,
-                                                             Max,
-                                                             std::is_signed_v<std::underlying_type_t<E>>)>{});
-
-
+#if !defined(__NVCOMPILER) && !defined(__RESHARPER__)
+  // those 2 backends have no `is_out_of_range`
   template<typename E, auto Min, decltype(Min) Max>
   inline constexpr bool has_a_value_in = details::is_out_of_range<E, Min>(
     std::make_index_sequence<
       details::get_index_sequence_max(false, has_fixed_underlying_type<E>, sizeof(E), Min, Max, std::is_signed_v<std::underlying_type_t<E>>)>{});
+#endif
+
+#if ENCHANTUM_DISCOVER_RANGE_BLOCK_SIZE > 0 && !defined(__RESHARPER__) && !defined(__NVCOMPILER) && \
+  (defined(__clang__) || defined(__GNUC__))
+  #define ENCHANTUM_DETAILS_DISCOVER_RANGE
+
+  // a block is never larger than a reflection chunk so reflecting a block reuses the instantiation that probed it
+  inline constexpr std::size_t discovery_block_size = details::Min(std::size_t{ENCHANTUM_DISCOVER_RANGE_BLOCK_SIZE},
+                                                                   std::size_t{ENCHANTUM_REFLECTION_CHUNK_SIZE});
+
+  // the values [Min + first, Min + first + size) that need to be reflected
+  struct DiscoveredRange {
+    std::size_t first = 0;
+    std::size_t size  = 0;
+  };
+
+  // probes the `Size` values starting at `Min` block by block, instantiating all of them, and returns the span of the blocks having a value
+  template<typename E, auto Min, std::size_t Size, std::size_t... Blocks>
+  constexpr DiscoveredRange discover_range(std::index_sequence<Blocks...>) noexcept
+  {
+    using T                    = decltype(Min);
+    constexpr auto block       = discovery_block_size;
+    constexpr bool has_value[] = {
+      has_a_value_in<E,
+                     static_cast<T>(Min + static_cast<T>(Blocks * block)),
+                     static_cast<T>(Min + static_cast<T>(Blocks * block +
+                                                         details::reflection_chunk_size(Size, Blocks, block) - 1))>...,
+      false};
+
+    std::size_t first = sizeof...(Blocks);
+    std::size_t last  = 0;
+    for (std::size_t i = 0; i < sizeof...(Blocks); ++i) {
+      if (has_value[i]) {
+        first = details::Min(first, i);
+        last  = i + 1;
+      }
+    }
+    // no values at all, the first block is reflected to find nothing
+    if (first == sizeof...(Blocks))
+      return DiscoveredRange{0, details::reflection_chunk_size(Size, 0, block)};
+    return DiscoveredRange{first * block, details::Min(Size, last * block) - first * block};
+  }
+#endif
+
+  // true for enums whose `entries` are declared by a macro instead of being reflected
+  template<typename E>
+  inline constexpr bool has_declared_entries = false;
+
+  // true for enums declared with `ENCHANTUM_EXTERN_REFLECTION`, their names are only reflected
+  // in the translation unit having `ENCHANTUM_DEFINE_REFLECTION` which sets `defines_extern_reflection`
+  template<typename E>
+  inline constexpr bool has_extern_reflection = false;
+
+  template<typename E>
+  inline constexpr bool defines_extern_reflection = false;
+
+  // the `entries` declared by `ENCHANTUM_DECLARE_ENTRIES`
+  template<typename E>
+  inline constexpr auto declared_entries = std::array<std::pair<E, string_view>, 0>{};
+
+  template<typename E, std::size_t N>
+  constexpr auto make_declared_entries(const std::pair<E, string_view> (&declared)[N]) noexcept
+  {
+    std::array<std::pair<E, string_view>, N> ret{};
+    for (std::size_t i = 0; i < N; ++i) {
+      ret[i].first  = declared[i].first;
+      ret[i].second = declared[i].second;
+    }
+    return ret;
+  }
+
+  template<typename E, std::size_t N>
+  constexpr bool are_declared_values_ascending(const std::array<std::pair<E, string_view>, N>& declared) noexcept
+  {
+    using T = std::underlying_type_t<E>;
+    for (std::size_t i = 1; i < N; ++i)
+      if (!(static_cast<T>(declared[i - 1].first) < static_cast<T>(declared[i].first)))
+        return false;
+    return true;
+  }
+
+  template<typename E, std::size_t N>
+  constexpr bool are_declared_names_unique(const std::array<std::pair<E, string_view>, N>& declared) noexcept
+  {
+    for (std::size_t i = 0; i < N; ++i) {
+      if (declared[i].second.empty())
+        return false;
+      for (std::size_t j = i + 1; j < N; ++j)
+        if (declared[i].second == declared[j].second)
+          return false;
+    }
+    return true;
+  }
+
+  // defined after `entries` which it returns
+  template<typename E>
+  constexpr const auto& specialized_entries() noexcept;
+
+  // `entries<E>` when it is specialized by the user otherwise the ones of `ENCHANTUM_DECLARE_ENTRIES`
+  template<typename E>
+  constexpr const auto& given_entries() noexcept
+  {
+    if constexpr (has_specialized_entries<E>)
+      return details::specialized_entries<E>();
+    else
+      return declared_entries<E>;
+  }
+
+  // everything using `entries` relies on the values being sorted, so the given ones are checked
+  template<typename E>
+  constexpr void check_declared_entries() noexcept
+  {
+    static_assert(details::are_declared_values_ascending(details::given_entries<E>()),
+                  "enchantum: declared or specialized entries must have unique values in ascending order like entries<E>");
+    static_assert(details::are_declared_names_unique(details::given_entries<E>()),
+                  "enchantum: declared or specialized entries must have unique and not empty names");
+  }
+
+  // what a backend would have reflected taken from `given_entries<E>()` instead
+  template<typename E, bool Names>
+  constexpr auto reflect_declared() noexcept
+  {
+    details::check_declared_entries<E>();
+    constexpr auto& enums               = details::given_entries<E>();
+    constexpr auto  total_string_length = []() {
+      std::size_t ret = 0;
+      for (const auto& entry : details::given_entries<E>())
+        ret += entry.second.size() + 1;
+      return ret;
+    }();
+    using T = std::underlying_type_t<E>;
+
+    std::conditional_t<Names,
+                       ReflectStringReturnValue<T, enums.size(), total_string_length>,
+                       ReflectValuesReturnValue<T, enums.size()>>
+      ret;
+    for (const auto& [value, name] : enums) {
+      ret.values[ret.valid_count] = static_cast<T>(value);
+      if constexpr (Names) {
+        ret.string_lengths[ret.valid_count] = name.size();
+        for (std::size_t i = 0; i < name.size(); ++i)
+          ret.strings[ret.total_string_length + i] = name[i];
+      }
+      ++ret.valid_count;
+      ret.total_string_length += name.size() + 1;
+    }
+    return ret;
+  }
+
+  // the names are always reflected null terminated, the storage without the null terminators is derived from it.
+  // without `Names` only the values are stored
+  template<typename E, bool Names, auto Min, decltype(Min) Max>
+  constexpr auto reflect_range() noexcept
+  {
+    if constexpr (Names)
+      static_assert(!has_extern_reflection<E> || defines_extern_reflection<E>,
+                    "enchantum: this enum is declared with ENCHANTUM_EXTERN_REFLECTION so its names are only "
+                    "available through to_string, to_string_unchecked, cast, contains, cast_batch and the bitflag "
+                    "functions outside of the translation unit having ENCHANTUM_DEFINE_REFLECTION");
+    constexpr auto size = details::get_index_sequence_max(is_bitflag<E>,
+                                                          has_fixed_underlying_type<E>,
+                                                          sizeof(E),
+                                                          Min,
+                                                          Max,
+                                                          std::is_signed_v<std::underlying_type_t<E>>);
+    if constexpr (has_declared_entries<E> || has_specialized_entries<E>) {
+      return details::reflect_declared<E, Names>();
+    }
+    else
+#ifdef ENCHANTUM_DETAILS_DISCOVER_RANGE
+    if constexpr (!is_bitflag<E> && !has_specialized_traits<E> && !std::is_same_v<std::underlying_type_t<E>, bool>) {
+      using T              = decltype(Min);
+      constexpr auto range = details::discover_range<E, Min, size>(
+        std::make_index_sequence<details::reflection_chunk_count(size, discovery_block_size)>{});
+      constexpr auto first = static_cast<T>(Min + static_cast<T>(range.first));
+      if constexpr (Names)
+        return details::reflect<E, true, first, discovery_block_size>(std::make_index_sequence<range.size>{});
+      else
+        return details::reflect_values<E, first, discovery_block_size>(std::make_index_sequence<range.size>{});
+    }
+    else
+#endif
+    {
+      if constexpr (Names)
+        return details::reflect<E, true, Min>(std::make_index_sequence<size>{});
+      else
+        return details::reflect_values<E, Min>(std::make_index_sequence<size>{});
+    }
+  }
+
+  // shared by both `NullTerminated` layouts so an enum is only reflected once
+  template<typename E, auto Min = enum_traits<E>::min, decltype(Min) Max = enum_traits<E>::max>
+  inline constexpr auto reflection_data_impl = details::reflect_range<E, true, Min, Max>();
+
+  // the values alone so using only them never copies the names
+  template<typename E, auto Min = enum_traits<E>::min, decltype(Min) Max = enum_traits<E>::max>
+  inline constexpr auto reflection_values_impl = details::reflect_range<E, false, Min, Max>();
+
 
 
   // Thanks https://en.cppreference.com/w/cpp/utility/intcmp.html
@@ -126,17 +327,18 @@ namespace details {
       return (L::min)();
     return T(u);
   }
-  template<typename E, bool NullTerminated>
-  constexpr auto get_reflection_data() noexcept
+  // `ValidCount` is the number of values reflected in [enum_traits<E>::min, enum_traits<E>::max]
+  template<typename E, std::size_t ValidCount>
+  constexpr void check_fully_reflected() noexcept
   {
-    constexpr auto elements = reflection_data_impl<E, NullTerminated>.elements;
-    using StringLengthType = std::conditional_t<(elements.total_string_length < UINT8_MAX), std::uint8_t, std::uint16_t>;
 #if ENCHANTUM_CHECK_OUT_OF_BOUNDS_BY >= 2
     if constexpr (
   #if defined(__clang_major__) && __clang_major__ >= 20
       has_fixed_underlying_type<E> &&
   #endif
       !details::has_specialized_traits<E> && 
+      !details::has_declared_entries<E> && 
+      !has_specialized_entries<E> && 
       !is_bitflag<E> && 
       !std::is_same_v<std::underlying_type_t<E>,bool>) {
   #define ENCHANTUM_ERROR_STRING                                                    \
@@ -146,10 +348,10 @@ namespace details {
     "for more information"
     // TODO: switch to new check for those 2 compilers
   #if defined(__NVCOMPILER) || defined(__RESHARPER__)
-      static_assert(elements.valid_count == reflection_data_impl<E, NullTerminated,
+      static_assert(ValidCount == reflection_values_impl<E,
         details::ClampToRange<std::underlying_type_t<E>>(enum_traits<E>::min * ENCHANTUM_CHECK_OUT_OF_BOUNDS_BY),
         details::ClampToRange<std::underlying_type_t<E>>(enum_traits<E>::max * ENCHANTUM_CHECK_OUT_OF_BOUNDS_BY)
-    >.elements.valid_count,
+    >.valid_count,
           ENCHANTUM_ERROR_STRING);
   #else
       // check [min,max] * 2 but exluding [min,max]
@@ -181,6 +383,18 @@ namespace details {
     }
 #endif
 #undef ENCHANTUM_ERROR_STRING
+  }
+
+  template<typename E, bool NullTerminated>
+  constexpr auto get_reflection_data() noexcept
+  {
+    constexpr auto& elements            = reflection_data_impl<E>;
+    constexpr auto  total_string_length = elements.total_string_length - (NullTerminated ? 0 : elements.valid_count);
+    using StringLengthType              = std::conditional_t<
+      (total_string_length < UINT8_MAX),
+      std::uint8_t,
+      std::conditional_t<(total_string_length < UINT16_MAX), std::uint16_t, std::uint32_t>>;
+    details::check_fully_reflected<E, elements.valid_count>();
       
     FinalReflectionResult<E, StringLengthType, elements.valid_count> ret;
     std::size_t                                                      i            = 0;
@@ -207,7 +421,24 @@ namespace details {
 
 
   template<typename E, bool NullTerminated>
-  inline constexpr auto reflection_data_string_storage = details::reflection_data_impl<E, NullTerminated>.strings;
+  inline constexpr auto reflection_data_string_storage = []() {
+    constexpr auto& elements = reflection_data_impl<E>;
+    if constexpr (NullTerminated) {
+      std::array<char, elements.total_string_length> ret{};
+      for (std::size_t i = 0; i < ret.size(); ++i)
+        ret[i] = elements.strings[i];
+      return ret;
+    }
+    else {
+      // the same names with their null terminators dropped
+      std::array<char, elements.total_string_length - elements.valid_count> ret{};
+      std::size_t                                                           n = 0;
+      for (std::size_t i = 0; i < elements.total_string_length; ++i)
+        if (elements.strings[i] != '\0')
+          ret[n++] = elements.strings[i];
+      return ret;
+    }
+  }();
 
   template<typename E, bool NullTerminated>
   inline constexpr auto reflection_data = details::get_reflection_data<E, NullTerminated>();
@@ -265,16 +496,43 @@ template<typename E,
 #endif
 inline constexpr auto entries = enchantum::details::get_entries<E, Pair, NullTerminated>();
 
+namespace details {
+  template<typename E>
+  constexpr const auto& specialized_entries() noexcept
+  {
+    return entries<E>;
+  }
+} // namespace details
+
 namespace details {
   template<typename E>
   constexpr auto get_values() noexcept
   {
-    constexpr auto              enums = entries<E>;
-    std::array<E, enums.size()> ret{};
-    const auto* const           enums_data = enums.data();
-    for (std::size_t i = 0; i < ret.size(); ++i)
-      ret[i] = enums_data[i].first;
-    return ret;
+    if constexpr (has_declared_entries<E>) {
+      constexpr auto              enums = entries<E>;
+      std::array<E, enums.size()> ret{};
+      const auto* const           enums_data = enums.data();
+      for (std::size_t i = 0; i < ret.size(); ++i)
+        ret[i] = enums_data[i].first;
+      return ret;
+    }
+    else {
+      // the values do not need the names so they are reflected without them
+      constexpr auto& elements = reflection_values_impl<E>;
+      static_assert(elements.valid_count != 0,
+                    "enchantum failed to reflect this enum.\n"
+                    "Please read https://github.com/ZXShady/enchantum/blob/main/docs/limitations.md before opening an "
+                    "issue\n"
+                    "with your enum type with all its namespace/classes it is defined inside to help the creator debug "
+                    "the "
+                    "issues.");
+      details::check_fully_reflected<E, elements.valid_count>();
+
+      std::array<E, elements.valid_count> ret{};
+      for (std::size_t i = 0; i < ret.size(); ++i)
+        ret[i] = static_cast<E>(elements.values[i]);
+      return ret;
+    }
   }
 
   template<typename E, typename String, bool NullTerminated>
@@ -302,19 +560,34 @@ inline constexpr auto names = details::get_names<E, String, NullTerminated>();
 
 
 #define ENCHANTUM_DECLARE_EMPTY(ENUM)                                                                         \
+  template<>                                                                                                  \
+  inline constexpr bool enchantum::details::has_declared_entries<ENUM> = true;                                \
   template<>                                                                                                  \
   inline constexpr auto enchantum::entries<ENUM> = ::std::array<std::pair<ENUM, ::enchantum::string_view>, 0> \
   {                                                                                                           \
   }
 
+// `ENCHANTUM_DECLARE_ENTRIES(Enum, {Enum::A, "A"}, {Enum::B, "B"})` declares the entries instead of reflecting them,
+// they must be in the order `entries` would be (ascending unique values, unique names) which is checked.
+// see `enchantum_generate_entries` in cmake/ to generate them
+#define ENCHANTUM_DECLARE_ENTRIES(ENUM, ...)                                                    \
+  template<>                                                                                    \
+  inline constexpr auto enchantum::details::declared_entries<ENUM> =                            \
+    ::enchantum::details::make_declared_entries<ENUM>({__VA_ARGS__});                           \
+  template<>                                                                                    \
+  inline constexpr bool enchantum::details::has_declared_entries<ENUM> = true;                  \
+  template<>                                                                                    \
+  inline constexpr auto enchantum::entries<ENUM> =                                              \
+    (::enchantum::details::check_declared_entries<ENUM>(), ::enchantum::details::declared_entries<ENUM>)
+
 template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
-inline constexpr auto min = entries<E>.front().first;
+inline constexpr auto min = values<E>.front();
 
 template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
-inline constexpr auto max = entries<E>.back().first;
+inline constexpr auto max = values<E>.back();
 
 template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
-inline constexpr std::size_t count = entries<E>.size();
+inline constexpr std::size_t count = values<E>.size();
 
 
 template<typename E>
@@ -339,10 +612,10 @@ inline constexpr bool is_contiguous = []() {
 template<typename E>
 inline constexpr bool is_contiguous_bitflag = [](const auto is_bitflag) {
   if constexpr (is_bitflag.value) {
-    constexpr auto& enums = entries<E>;
+    constexpr auto& enums = values<E>;
     using T               = std::underlying_type_t<E>;
     for (auto i = std::size_t{has_zero_flag<E>}; i < enums.size() - 1; ++i)
-      if (T(enums[i].first) << 1 != T(enums[i + 1].first))
+      if (T(enums[i]) << 1 != T(enums[i + 1]))
         return false;
     return true;
   }
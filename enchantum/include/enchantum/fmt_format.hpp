@@ -13,9 +13,19 @@ template<typename E>
 struct fmt::formatter<E, char, std::enable_if_t<std::is_enum_v<E>>>
 #endif
 : fmt::formatter< ::enchantum::string_view> {
+  ::enchantum::format_options options;
+
+  template<typename ParseContext>
+  constexpr auto parse(ParseContext& ctx)
+  {
+    ctx.advance_to(::enchantum::details::parse_format_options(ctx.begin(), ctx.end(), options));
+    return fmt::formatter< ::enchantum::string_view>::parse(ctx);
+  }
+
   template<typename FmtContext>
   constexpr auto format(const E e, FmtContext& ctx) const
   {
-    return fmt::formatter< ::enchantum::string_view>::format(enchantum::details::format(e), ctx);
+    ::enchantum::details::format_buffer<E> buffer;
+    return fmt::formatter< ::enchantum::string_view>::format(enchantum::details::format(e, buffer, options), ctx);
   }
 };
\ No newline at end of file
@@ -3,6 +3,7 @@
 #ifdef __cpp_impl_three_way_comparison
   #include <compare>
 #endif
+#include "details/char_names.hpp"
 #include "details/countr_zero.hpp"
 #include <cstddef>
 #include <cstdint>
@@ -20,9 +21,10 @@ namespace details {
 
   template<typename CRTP, std::ptrdiff_t Size>
   struct sized_iterator {
-    static_assert(Size < INT16_MAX, "Too many enum entries");
   public:
-    using IndexType = std::conditional_t<(Size <= INT8_MAX), std::int8_t, std::int16_t>;
+    using IndexType = std::conditional_t<(Size <= INT8_MAX),
+                                         std::int8_t,
+                                         std::conditional_t<(Size <= INT16_MAX), std::int16_t, std::int32_t>>;
     IndexType       index{};
     constexpr CRTP& operator+=(const std::ptrdiff_t offset) & noexcept
     {
@@ -107,9 +109,16 @@ namespace details {
       using value_type = String;
       [[nodiscard]] constexpr String operator*() const noexcept
       {
-        const auto* const p       = details::reflection_string_indices<E, NullTerminated>.data();
-        const auto* const strings = details::reflection_data_string_storage<E, NullTerminated>.data();
-        return String(strings + p[this->index], p[this->index + 1] - p[this->index] - NullTerminated);
+        using CharT = typename details::string_char_type<String>::type;
+        if constexpr (details::is_transcoded_char<CharT>) {
+          const auto name = details::char_name<E, CharT>(static_cast<std::size_t>(this->index));
+          return String(name.data(), name.size());
+        }
+        else {
+          const auto* const p       = details::reflection_string_indices<E, NullTerminated>.data();
+          const auto* const strings = details::reflection_data_string_storage<E, NullTerminated>.data();
+          return String(strings + p[this->index], p[this->index + 1] - p[this->index] - NullTerminated);
+        }
       }
 
       [[nodiscard]] constexpr String operator[](const std::ptrdiff_t i) const noexcept { return *(*this + i); }
@@ -3,38 +3,96 @@
 #include "bitflags.hpp"
 #include "details/format_util.hpp"
 #include "enchantum.hpp"
+#include <array>
+#include <cstddef>
 #include <iostream>
-#include <string>
+#include <locale>
+#include <string_view>
 
 namespace enchantum {
+namespace details {
+  // the longest name `operator>>` can match, bitflags are matched one flag at a time
+  template<typename E>
+  inline constexpr std::size_t max_token_size = []() {
+    std::size_t ret = 1;
+    for (const auto name : names_generator<E>)
+      ret = details::Max(ret, name.size());
+    return ret;
+  }();
+} // namespace details
+
 namespace iostream_operators {
   template<typename Traits, ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
   std::basic_ostream<char, Traits>& operator<<(std::basic_ostream<char, Traits>& os, const E e)
   {
-    return os << details::format(e);
+    details::format_buffer<E> buffer;
+    const auto                s    = details::format(e, buffer);
+    const auto                size = static_cast<std::streamsize>(s.size());
+    if (os.width() == 0)
+      return os.write(s.data(), size);
+    return os << std::basic_string_view<char, Traits>(s.data(), s.size()); // padding
   }
 
+  // reads a whitespace separated token like `operator>>` for strings does but into a buffer
+  // sized to the longest name, the flags of a bitflag token are matched one by one while reading
+  // so repeating a flag is accepted like `cast_bitflag` does. Longer tokens are consumed and fail.
   template<typename Traits, ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
   auto operator>>(std::basic_istream<char, Traits>& is, E& value) -> decltype((value = E{}, is))
   // sfinae to check whether value is assignable
   {
-    std::basic_string<char, Traits> s;
-    is >> s;
-    if (!is)
+    const typename std::basic_istream<char, Traits>::sentry sentry(is);
+    if (!sentry)
       return is;
 
-    if constexpr (is_bitflag<E>) {
-      if (const auto v = enchantum::cast_bitflag<E>(s))
-        value = *v;
+    using T = std::underlying_type_t<E>;
+    std::array<char, details::max_token_size<E>> buffer;
+    std::size_t                                  size    = 0;
+    bool                                         invalid = false;
+    T                                            flags{};
+
+    // matches the name in `buffer` and ORs its value
+    const auto add_flag = [&]() {
+      const auto i = invalid ? count<E> : details::name_index_of<E>(string_view(buffer.data(), size));
+      if (i == count<E>)
+        invalid = true;
       else
-        is.setstate(std::ios_base::failbit);
-    }
-    else {
-      if (const auto v = enchantum::cast<E>(s))
-        value = *v;
+        flags = static_cast<T>(flags | static_cast<T>(values_generator<E>[i]));
+      size = 0;
+    };
+
+    auto* const            buf   = is.rdbuf();
+    const auto&            ctype = std::use_facet<std::ctype<char>>(is.getloc());
+    std::ios_base::iostate state = std::ios_base::goodbit;
+    // like for strings a positive width is the most characters read
+    auto remaining = is.width() > 0 ? static_cast<std::size_t>(is.width()) : std::size_t(-1);
+    for (auto c = buf->sgetc();; c = buf->snextc()) {
+      if (Traits::eq_int_type(c, Traits::eof())) {
+        state |= std::ios_base::eofbit;
+        break;
+      }
+      const auto ch = Traits::to_char_type(c);
+      if (ctype.is(std::ctype_base::space, ch))
+        break;
+      if (is_bitflag<E> && ch == '|')
+        add_flag();
+      else if (size == buffer.size())
+        invalid = true;
       else
-        is.setstate(std::ios_base::failbit);
+        buffer[size++] = ch;
+      if (--remaining == 0) {
+        buf->sbumpc();
+        break;
+      }
     }
+    is.width(0);
+
+    // the last flag or the only name of an enum that is not a bitflag
+    add_flag();
+    if (invalid)
+      state |= std::ios_base::failbit;
+    else
+      value = static_cast<E>(flags);
+    is.setstate(state);
     return is;
   }
 } // namespace iostream_operators
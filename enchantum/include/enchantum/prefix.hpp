@@ -0,0 +1,78 @@
+#pragma once
+
+#include "common.hpp"
+#include "details/name_trie.hpp"
+#include "details/optional.hpp"
+#include "details/sorted_names.hpp"
+#include "details/string_view.hpp"
+#include "enchantum.hpp"
+#include "generators.hpp"
+#include <cstddef>
+#include <utility>
+
+namespace enchantum {
+namespace details {
+
+  // the entries of `E` at positions [first,last) of `sorted_name_order<E>`
+  template<typename E, typename Pair>
+  struct sorted_entries_range {
+    using value_type = Pair;
+
+    struct iterator : sized_iterator<iterator, static_cast<std::ptrdiff_t>(count<E>)> {
+      using value_type = Pair;
+      [[nodiscard]] constexpr Pair operator*() const noexcept
+      {
+        const auto i = static_cast<std::size_t>(sorted_name_order<E>[static_cast<std::size_t>(this->index)]);
+        return Pair{values_generator<E>[i], names_generator<E>[i]};
+      }
+      [[nodiscard]] constexpr Pair operator[](const std::ptrdiff_t i) const noexcept { return *(*this + i); }
+    };
+
+    std::size_t first = 0;
+    std::size_t last  = 0;
+
+    [[nodiscard]] constexpr auto begin() const noexcept
+    {
+      return iterator{{static_cast<typename iterator::IndexType>(first)}};
+    }
+    [[nodiscard]] constexpr auto end() const noexcept
+    {
+      return iterator{{static_cast<typename iterator::IndexType>(last)}};
+    }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return last - first; }
+    [[nodiscard]] constexpr bool        empty() const noexcept { return first == last; }
+
+    [[nodiscard]] constexpr Pair operator[](const std::size_t i) const noexcept
+    {
+      return *(begin() + static_cast<std::ptrdiff_t>(i));
+    }
+  };
+
+} // namespace details
+
+// all the entries whose name starts with `prefix` sorted by name, an empty prefix gives all entries.
+// costs two binary searches over the names sorted at compile time.
+#ifdef __cpp_concepts
+template<Enum E, typename Pair = std::pair<E, string_view>>
+#else
+template<typename E, typename Pair = std::pair<E, string_view>, std::enable_if_t<std::is_enum_v<E>, int> = 0>
+#endif
+[[nodiscard]] constexpr details::sorted_entries_range<E, Pair> entries_with_prefix(const string_view prefix) noexcept
+{
+  return details::sorted_entries_range<E, Pair>{details::sorted_name_bound<E, false, true>(prefix),
+                                                details::sorted_name_bound<E, true, true>(prefix)};
+}
+
+// the longest name of `E` that `input` starts with and the amount of characters it consumed.
+// walks a trie of the names built at compile time so it reads every character of `input` at most once
+// and stops at the first character that can not continue any name.
+template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
+[[nodiscard]] constexpr optional<std::pair<E, std::size_t>> cast_prefix(const string_view input) noexcept
+{
+  const auto [i, length] = details::longest_name_prefix<E>(input);
+  if (i == count<E>)
+    return optional<std::pair<E, std::size_t>>();
+  return optional<std::pair<E, std::size_t>>(std::pair<E, std::size_t>(values_generator<E>[i], length));
+}
+
+} // namespace enchantum
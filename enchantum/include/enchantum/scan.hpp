@@ -0,0 +1,78 @@
+#pragma once
+
+#include "common.hpp"
+#include "details/name_automaton.hpp"
+#include "details/string_view.hpp"
+#include "entries.hpp"
+#include "generators.hpp"
+#include <cstddef>
+#include <type_traits>
+
+namespace enchantum {
+
+// finds every occurrence of the names of `E` in text fed to it in one or more chunks.
+// matches may overlap and may span chunks, offsets count from the start of the first chunk.
+template<typename E>
+class name_scanner {
+  static_assert(std::is_enum_v<E>);
+
+  std::size_t node     = 0;
+  std::size_t consumed = 0;
+public:
+  // calls `func(offset, value)` for every name ending inside `chunk` in order of its end
+  template<typename Func>
+  constexpr void operator()(const string_view chunk, Func func)
+    noexcept(std::is_nothrow_invocable_v<Func&, std::size_t, E>)
+  {
+    constexpr auto&   trie      = details::name_trie<E>;
+    constexpr auto&   automaton = details::name_automaton<E>;
+    const auto* const indices   = details::reflection_string_indices<E, true>.data();
+    const auto* const data      = chunk.data();
+    const auto        size      = chunk.size();
+
+    auto n = node;
+    for (std::size_t i = 0; i < size; ++i) {
+      if (n == 0) {
+        // skip the bytes no name starts with without following any links
+        while (i < size && automaton.root[static_cast<unsigned char>(data[i])] == 0)
+          ++i;
+        if (i == size)
+          break;
+        n = automaton.root[static_cast<unsigned char>(data[i])];
+      }
+      else {
+        n = automaton.next(trie, n, data[i]);
+      }
+      auto m = trie.terminal[n] != count<E> ? n : std::size_t{automaton.output[n]};
+      for (; m != 0; m = automaton.output[m]) {
+        const std::size_t index  = trie.terminal[m];
+        const std::size_t length = static_cast<std::size_t>(indices[index + 1] - indices[index] - 1);
+        func(consumed + i + 1 - length, values_generator<E>[index]);
+      }
+    }
+    node = n;
+    consumed += size;
+  }
+
+  // the amount of characters fed so far
+  [[nodiscard]] constexpr std::size_t position() const noexcept { return consumed; }
+
+  // forgets partial matches so the next chunk is treated as the start of a new text
+  constexpr void reset() noexcept
+  {
+    node     = 0;
+    consumed = 0;
+  }
+};
+
+// calls `func(offset, value)` for every occurrence of a name of `E` in `text` in one pass,
+// equivalent to searching for every name separately but costs O(text.size() + matches).
+template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E), typename Func>
+constexpr void scan_names(const string_view text, Func func)
+  noexcept(std::is_nothrow_invocable_v<Func&, std::size_t, E>)
+{
+  name_scanner<E> scanner;
+  scanner(text, func);
+}
+
+} // namespace enchantum
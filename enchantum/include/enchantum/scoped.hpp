@@ -2,6 +2,7 @@
 
 #include "bitflags.hpp"
 #include "common.hpp"
+#include "details/scoped_names.hpp"
 #include "details/string.hpp"
 #include "details/string_view.hpp"
 #include "enchantum.hpp"
@@ -36,11 +37,26 @@ namespace scoped {
     }
   } // namespace details
 
+  namespace details {
+    // the index of the scoped name `input` or `count<E>`, the name after the scope is looked up
+    // and the whole input is then compared to the precomputed scoped name which checks the scope too
+    template<typename E>
+    [[nodiscard]] constexpr std::size_t scoped_name_to_index(const string_view input) noexcept
+    {
+      constexpr auto scope = type_name<E>.size() + 2;
+      if (input.size() <= scope)
+        return count<E>;
+      const auto i = enchantum::details::name_to_index<E>(string_view(input.data() + scope, input.size() - scope));
+      if (i != count<E> && enchantum::details::scoped_name<E>(i) == input)
+        return i;
+      return count<E>;
+    }
+  } // namespace details
+
   template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
   [[nodiscard]] constexpr bool contains(const string_view name) noexcept
   {
-    const auto n = details::remove_scope_or_empty(name, type_name<E>);
-    return !n.empty() && enchantum::contains<E>(n);
+    return details::scoped_name_to_index<E>(name) != count<E>;
   }
 
   template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E), typename BinaryPredicate>
@@ -55,8 +71,9 @@ namespace scoped {
     struct scoped_cast_functor {
       [[nodiscard]] constexpr optional<E> operator()(const string_view name) const noexcept
       {
-        const auto n = details::remove_scope_or_empty(name, type_name<E>);
-        return n.empty() ? optional<E>() : cast<E>(n);
+        if (const auto i = details::scoped_name_to_index<E>(name); i != count<E>)
+          return optional<E>(values_generator<E>[i]);
+        return optional<E>();
       }
 
       template<typename BinaryPred>
@@ -68,18 +85,13 @@ namespace scoped {
     };
 
     struct to_scoped_string_functor {
-      // hacky workaround about string not being a literal type.
-      template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E), typename String = string>
-      [[nodiscard]] constexpr String operator()(const E value) const noexcept
+      // points to names precomputed at compile time so nothing is allocated
+      template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
+      [[nodiscard]] constexpr string_view operator()(const E value) const noexcept
       {
-        String s;
-        if (const auto i = enchantum::enum_to_index(value)) {
-          s += type_name<E>;
-          s += "::";
-          s += names_generator<E>[*i];
-          return s;
-        }
-        return s;
+        if (const auto i = enchantum::enum_to_index(value))
+          return enchantum::details::scoped_name<E>(*i);
+        return string_view();
       }
     };
   } // namespace details
@@ -93,25 +105,13 @@ namespace scoped {
   template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E), typename BinaryPred>
   [[nodiscard]] constexpr bool contains_bitflag(const string_view s, const char sep, const BinaryPred binary_pred) noexcept
   {
-    std::size_t pos = 0;
-    for (std::size_t i = s.find(sep); i != s.npos; i = s.find(sep, pos)) {
-      if (!enchantum::scoped::contains<E>(s.substr(pos, i - pos), binary_pred))
-        return false;
-      pos = i + 1;
-    }
-    return enchantum::scoped::contains<E>(s.substr(pos), binary_pred);
+    return static_cast<bool>(enchantum::details::cast_bitflag<E>(s, sep, binary_pred, true));
   }
 
   template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E)>
   [[nodiscard]] constexpr bool contains_bitflag(const string_view s, const char sep = '|') noexcept
   {
-    std::size_t pos = 0;
-    for (std::size_t i = s.find(sep); i != s.npos; i = s.find(sep, pos)) {
-      if (!enchantum::scoped::contains<E>(s.substr(pos, i - pos)))
-        return false;
-      pos = i + 1;
-    }
-    return enchantum::scoped::contains<E>(s.substr(pos));
+    return static_cast<bool>(enchantum::details::cast_bitflag<E>(s, sep, nullptr, true));
   }
 
 
@@ -121,52 +121,55 @@ namespace scoped {
     using T = std::underlying_type_t<E>;
     if constexpr (has_zero_flag<E>)
       if (static_cast<T>(value) == 0)
-        return enchantum::scoped::to_string(value);
-
-    String         name;
-    T              check_value = 0;
-    constexpr auto scope_name  = type_name<E>;
-    for (auto i = std::size_t{has_zero_flag<E>}; i < count<E>; ++i) {
-      const auto v = static_cast<T>(values_generator<E>[i]);
-      if (v == (static_cast<T>(value) & v)) {
-        if (!name.empty())
-          name.append(1, sep); // append separator if not the first value
-        name.append(scope_name.data(), scope_name.size());
-        name.append("::", 2);
-        const auto s = names_generator<E>[i];
-        name.append(s.data(), s.size()); // not using operator += since this may not be std::string_view always
-        check_value |= v;
-      }
-    }
-    if (check_value == static_cast<T>(value))
+        return String(enchantum::details::scoped_name<E>(0));
+
+    String     name;
+    const bool valid = enchantum::details::for_each_set_flag(value, [&name, sep](const std::size_t i) {
+      const auto s = enchantum::details::scoped_name<E>(i);
+      if (!name.empty())
+        name.append(1, sep);           // append separator if not the first value
+      name.append(s.data(), s.size()); // not using operator += since this may not be std::string_view always
+    });
+    if (valid)
       return name;
-    return string();
+    return String();
   }
 
 
   template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E), typename BinaryPred>
   [[nodiscard]] constexpr optional<E> cast_bitflag(const string_view s, const char sep, const BinaryPred binary_pred) noexcept
   {
-    using T = std::underlying_type_t<E>;
-    T           check_value{};
-    std::size_t pos = 0;
-    for (std::size_t i = s.find(sep); i != s.npos; i = s.find(sep, pos)) {
-      if (const auto v = enchantum::scoped::cast<E>(s.substr(pos, i - pos), binary_pred))
-        check_value |= static_cast<T>(*v);
-      else
-        return optional<E>();
-      pos = i + 1;
-    }
-
-    if (const auto v = enchantum::scoped::cast<E>(s.substr(pos), binary_pred))
-      return optional<E>(static_cast<E>(check_value | static_cast<T>(*v)));
-    return optional<E>();
+    return enchantum::details::cast_bitflag<E>(s, sep, binary_pred, true);
   }
 
   template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E)>
   [[nodiscard]] constexpr optional<E> cast_bitflag(const string_view s, const char sep = '|') noexcept
   {
-    return enchantum::scoped::cast_bitflag<E>(s, sep, [](const auto& a, const auto& b) { return a == b; });
+    return enchantum::details::cast_bitflag<E>(s, sep, nullptr, true);
+  }
+
+  // same as `enchantum::parse_bitflag` but every flag is qualified by `type_name<E>`
+  template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E), typename BinaryPred>
+  [[nodiscard]] constexpr parse_bitflag_result<E> parse_bitflag(const string_view input,
+                                                                const string_view separators,
+                                                                const BinaryPred  binary_pred) noexcept
+  {
+    return enchantum::details::parse_bitflag<E>(input,
+                                                enchantum::details::separator_chars{separators},
+                                                binary_pred,
+                                                true,
+                                                true);
+  }
+
+  template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E)>
+  [[nodiscard]] constexpr parse_bitflag_result<E> parse_bitflag(const string_view input,
+                                                                const string_view separators = "|") noexcept
+  {
+    return enchantum::details::parse_bitflag<E>(input,
+                                                enchantum::details::separator_chars{separators},
+                                                nullptr,
+                                                true,
+                                                true);
   }
 } // namespace scoped
 } // namespace enchantum
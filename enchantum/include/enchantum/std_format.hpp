@@ -7,9 +7,19 @@
 
 template<enchantum::Enum E>
 struct std::formatter<E> : std::formatter< ::enchantum::string_view> {
+  ::enchantum::format_options options;
+
+  template<typename ParseContext>
+  constexpr auto parse(ParseContext& ctx)
+  {
+    ctx.advance_to(::enchantum::details::parse_format_options(ctx.begin(), ctx.end(), options));
+    return std::formatter< ::enchantum::string_view>::parse(ctx);
+  }
+
   template<typename FmtContext>
   constexpr auto format(const E e, FmtContext& ctx) const
   {
-    return std::formatter< ::enchantum::string_view>::format(enchantum::details::format(e), ctx);
+    ::enchantum::details::format_buffer<E> buffer;
+    return std::formatter< ::enchantum::string_view>::format(enchantum::details::format(e, buffer, options), ctx);
   }
 };
\ No newline at end of file
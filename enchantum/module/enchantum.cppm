@@ -0,0 +1,126 @@
+module;
+
+#include <enchantum/all.hpp>
+#include <enchantum/scoped.hpp>
+
+export module enchantum;
+
+// the macros (ENCHANTUM_DEFINE_BITWISE_FOR, ENCHANTUM_DECLARE_EMPTY, ...) can not be exported,
+// include the header defining them next to `import enchantum;` when they are needed.
+export namespace enchantum {
+// common.hpp
+using enchantum::BitFlagEnum;
+using enchantum::Enum;
+using enchantum::EnumFixedUnderlying;
+using enchantum::EnumOfUnderlying;
+using enchantum::enum_traits;
+using enchantum::has_fixed_underlying_type;
+using enchantum::index_lookup_strategy;
+using enchantum::is_bitflag;
+using enchantum::is_scoped_enum;
+using enchantum::is_unscoped_enum;
+using enchantum::ScopedEnum;
+using enchantum::SignedEnum;
+using enchantum::UnscopedEnum;
+using enchantum::UnsignedEnum;
+using enchantum::optional;
+using enchantum::string;
+using enchantum::string_view;
+
+// type_name.hpp
+using enchantum::raw_type_name;
+using enchantum::type_name;
+
+// entries.hpp
+using enchantum::ContiguousBitFlagEnum;
+using enchantum::ContiguousEnum;
+using enchantum::count;
+using enchantum::entries;
+using enchantum::has_specialized_entries;
+using enchantum::has_zero_flag;
+using enchantum::is_contiguous;
+using enchantum::is_contiguous_bitflag;
+using enchantum::max;
+using enchantum::min;
+using enchantum::names;
+using enchantum::to_underlying;
+using enchantum::values;
+
+// generators.hpp
+using enchantum::entries_generator;
+using enchantum::names_generator;
+using enchantum::values_generator;
+
+// enchantum.hpp
+using enchantum::ascii_case_insensitive;
+using enchantum::cast;
+using enchantum::contains;
+using enchantum::enum_to_index;
+using enchantum::enum_to_index_unchecked;
+using enchantum::index_to_enum;
+using enchantum::to_string;
+using enchantum::to_string_unchecked;
+using enchantum::to_u16string;
+using enchantum::to_u32string;
+#ifdef __cpp_char8_t
+using enchantum::to_u8string;
+#endif
+using enchantum::to_wstring;
+
+// bitflags.hpp
+using enchantum::cast_bitflag;
+using enchantum::contains_bitflag;
+using enchantum::flag_entries_of;
+using enchantum::flags_of;
+using enchantum::parse_bitflag;
+using enchantum::parse_bitflag_result;
+using enchantum::to_string_bitflag;
+using enchantum::to_string_bitflag_max_size;
+using enchantum::value_ors;
+
+// algorithms.hpp, array.hpp, batch.hpp, bitset.hpp
+using enchantum::array;
+using enchantum::bitset;
+using enchantum::cast_batch;
+using enchantum::cast_batch_to_index;
+using enchantum::for_each;
+
+// charconv.hpp, next_value.hpp, prefix.hpp, scan.hpp, format_util.hpp
+using enchantum::cast_prefix;
+using enchantum::entries_with_prefix;
+using enchantum::format_options;
+using enchantum::from_chars;
+using enchantum::name_scanner;
+using enchantum::next_value;
+using enchantum::next_value_circular;
+using enchantum::prev_value;
+using enchantum::prev_value_circular;
+using enchantum::scan_names;
+using enchantum::to_chars;
+
+namespace bitwise_operators {
+  using enchantum::bitwise_operators::operator~;
+  using enchantum::bitwise_operators::operator|;
+  using enchantum::bitwise_operators::operator&;
+  using enchantum::bitwise_operators::operator^;
+  using enchantum::bitwise_operators::operator|=;
+  using enchantum::bitwise_operators::operator&=;
+  using enchantum::bitwise_operators::operator^=;
+} // namespace bitwise_operators
+
+namespace iostream_operators {
+  using enchantum::iostream_operators::operator<<;
+  using enchantum::iostream_operators::operator>>;
+} // namespace iostream_operators
+
+namespace scoped {
+  using enchantum::scoped::cast;
+  using enchantum::scoped::cast_bitflag;
+  using enchantum::scoped::contains;
+  using enchantum::scoped::contains_bitflag;
+  using enchantum::scoped::parse_bitflag;
+  using enchantum::scoped::to_string;
+  using enchantum::scoped::to_string_bitflag;
+} // namespace scoped
+} // namespace enchantum
+
@@ -0,0 +1,75 @@
+#include "test_utility.hpp"
+#include <array>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <enchantum/batch.hpp>
+#include <enchantum/enchantum.hpp>
+#include <string>
+#include <vector>
+
+TEMPLATE_LIST_TEST_CASE("cast_batch", "[cast][batch]", AllEnumsTestTypes)
+{
+  // names, misses and runs of repeated inputs
+  std::vector<std::string> storage;
+  for (const auto name : enchantum::names<TestType>) {
+    storage.emplace_back(name);
+    storage.emplace_back(name);
+    storage.emplace_back(std::string(name) + "_");
+    storage.emplace_back(name);
+  }
+  storage.emplace_back("");
+  std::vector<std::string_view> inputs(storage.begin(), storage.end());
+
+  std::vector<TestType>     values(inputs.size());
+  std::vector<std::size_t>  indices(inputs.size());
+  std::vector<std::uint8_t> validity((inputs.size() + 7) / 8, 0xFF);
+  std::vector<std::uint8_t> index_validity((inputs.size() + 7) / 8, 0xFF);
+
+  const auto valid = enchantum::cast_batch<TestType>(inputs.begin(), inputs.end(), values.data(), validity.data());
+  const auto valid_indices = enchantum::cast_batch_to_index<TestType>(inputs.begin(),
+                                                                      inputs.end(),
+                                                                      indices.data(),
+                                                                      index_validity.data());
+
+  std::size_t expected_valid = 0;
+  for (std::size_t i = 0; i < inputs.size(); ++i) {
+    const auto expected = enchantum::cast<TestType>(inputs[i]);
+    const bool bit      = (validity[i / 8] >> (i % 8)) & 1;
+    expected_valid += expected.has_value();
+    CHECK(bit == expected.has_value());
+    CHECK(bool((index_validity[i / 8] >> (i % 8)) & 1) == expected.has_value());
+    CHECK(values[i] == expected.value_or(TestType{}));
+    CHECK(indices[i] == (expected ? *enchantum::enum_to_index(*expected) : enchantum::count<TestType>));
+  }
+  CHECK(valid == expected_valid);
+  CHECK(valid_indices == expected_valid);
+  // bits past the last input are cleared
+  for (auto i = inputs.size(); i < validity.size() * 8; ++i)
+    CHECK(((validity[i / 8] >> (i % 8)) & 1) == 0);
+}
+
+TEST_CASE("cast_batch constexpr", "[cast][batch]")
+{
+  constexpr auto result = []() {
+    constexpr std::array<std::string_view, 4> inputs{"Green", "Green", "Purple?", "Aqua"};
+    std::array<Color, 4>                      out{};
+    std::array<std::uint8_t, 1>               validity{};
+    const auto valid = enchantum::cast_batch<Color>(inputs.begin(), inputs.end(), out.data(), validity.data());
+    return std::make_pair(valid, std::make_pair(out, validity[0]));
+  }();
+  STATIC_CHECK(result.first == 3);
+  STATIC_CHECK(result.second.first[0] == Color::Green);
+  STATIC_CHECK(result.second.first[1] == Color::Green);
+  STATIC_CHECK(result.second.first[2] == Color{});
+  STATIC_CHECK(result.second.first[3] == Color::Aqua);
+  STATIC_CHECK(result.second.second == 0b1011);
+}
+
+TEST_CASE("cast_batch_to_index without validity", "[cast][batch]")
+{
+  const std::vector<std::string> inputs{"a", "z", "zz", "m"};
+  std::vector<std::uint8_t>      indices(inputs.size());
+  CHECK(enchantum::cast_batch_to_index<Letters>(inputs.begin(), inputs.end(), indices.data()) == 3);
+  CHECK(indices == std::vector<std::uint8_t>{0, 25, 26, 12});
+}
@@ -9,6 +9,7 @@
 #include <enchantum/enchantum.hpp>
 #include <enchantum/iostream.hpp>
 #include <iostream>
+#include <iterator>
 #include <sstream>
 #include <string_view>
 
@@ -252,6 +253,22 @@ TEMPLATE_LIST_TEST_CASE("bitflags", "[bitflags]", AllFlagsTestTypes)
     }
   }
 
+  SECTION("to_string_bitflag to an output iterator")
+  {
+    for (const auto comb : combinations) {
+      std::array<char, enchantum::to_string_bitflag_max_size<TestType>> buffer{};
+      const auto end = enchantum::to_string_bitflag(buffer.data(), comb, ',');
+      CHECK(std::string_view(buffer.data(), static_cast<std::size_t>(end - buffer.data())) ==
+            enchantum::to_string_bitflag(comb, ','));
+
+      std::string s;
+      enchantum::to_string_bitflag(std::back_inserter(s), comb);
+      CHECK(s == enchantum::to_string_bitflag(comb));
+    }
+    CHECK(enchantum::to_string_bitflag(enchantum::value_ors<TestType>).size() ==
+          enchantum::to_string_bitflag_max_size<TestType>);
+  }
+
   SECTION("contains_bitflag(enum)")
   {
     for (const auto comb : combinations) {
@@ -303,4 +320,67 @@ TEMPLATE_LIST_TEST_CASE("contains_bitflag returns false for invalid combinations
 
   for (const auto comb : invalid_combinations)
     CHECK_FALSE(enchantum::contains_bitflag(comb));
-}
\ No newline at end of file
+}
+
+TEST_CASE("to_string_bitflag to a buffer", "[bitflags]")
+{
+  char       buffer[enchantum::to_string_bitflag_max_size<Flags>];
+  const auto end = enchantum::to_string_bitflag(buffer, Flags::Flag0 | Flags(1u << 7));
+  CHECK(end == buffer);
+
+  STATIC_CHECK(enchantum::to_string_bitflag_max_size<Flags> == 7 * 5 + 6);
+  STATIC_CHECK(enchantum::to_string_bitflag_max_size<FlagsWithNone> == 8 * 5 + 7);
+  constexpr auto written = []() {
+    std::array<char, enchantum::to_string_bitflag_max_size<FlagsWithNone>> ret{};
+    (void)enchantum::to_string_bitflag(ret.data(), FlagsWithNone::Flag1 | FlagsWithNone::Flag6);
+    return ret;
+  }();
+  STATIC_CHECK(std::string_view(written.data()) == "Flag1|Flag6");
+}
+
+TEST_CASE("parse_bitflag", "[casts][bitflags]")
+{
+  SECTION("whitespace and separator sets")
+  {
+    constexpr auto r = enchantum::parse_bitflag<Permission>(" Read | Write |Execute ");
+    STATIC_CHECK(r.value == (Permission::Read | Permission::Write | Permission::Execute));
+    STATIC_CHECK(r.position == 23);
+    STATIC_CHECK(enchantum::parse_bitflag<Permission>("Read,Write|Execute", ",|").value ==
+                 (Permission::Read | Permission::Write | Permission::Execute));
+    STATIC_CHECK(enchantum::parse_bitflag<Permission>("None").value == Permission::None);
+    STATIC_CHECK(enchantum::parse_bitflag<Level>("Level3\t|\nLevel1").value == (Level::Level3 | Level::Level1));
+  }
+
+  SECTION("separator strings")
+  {
+    STATIC_CHECK(enchantum::parse_bitflag<Permission>("Read || Write and Execute", {"||", "and"}).value ==
+                 (Permission::Read | Permission::Write | Permission::Execute));
+    STATIC_CHECK(enchantum::parse_bitflag<Permission>("Read|Write", {"|", "||"}).value ==
+                 (Permission::Read | Permission::Write));
+  }
+
+  SECTION("case insensitive")
+  {
+    STATIC_CHECK(enchantum::parse_bitflag<Permission>("READ,WRITE", ",", enchantum::ascii_case_insensitive).value ==
+                 (Permission::Read | Permission::Write));
+    STATIC_CHECK(enchantum::parse_bitflag<EntityStatus>("peNdIng | AcTive", "|", case_insensitive).value ==
+                 (EntityStatus::Pending | EntityStatus::Active));
+  }
+
+  SECTION("position of the first bad token")
+  {
+    constexpr auto r = enchantum::parse_bitflag<Permission>("Read | Wirte | Execute");
+    STATIC_CHECK_FALSE(r.value.has_value());
+    STATIC_CHECK(r.position == 7);
+    STATIC_CHECK(enchantum::parse_bitflag<Permission>("").position == 0);
+    STATIC_CHECK(enchantum::parse_bitflag<Permission>("Read||Write").position == 5);
+    STATIC_CHECK(enchantum::parse_bitflag<Permission>("Read|  ").position == 7);
+    STATIC_CHECK_FALSE(enchantum::parse_bitflag<Permission>("Read Write").value.has_value());
+  }
+
+  SECTION("cast_bitflag does not trim")
+  {
+    STATIC_CHECK_FALSE(enchantum::cast_bitflag<Permission>("Read | Write").has_value());
+    STATIC_CHECK_FALSE(enchantum::contains_bitflag<Permission>("Read | Write"));
+  }
+}
@@ -0,0 +1,78 @@
+#include "test_utility.hpp"
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <enchantum/enchantum.hpp>
+#include <string_view>
+
+namespace {
+template<typename CharT>
+bool equals_ascii(const std::basic_string_view<CharT> s, const std::string_view ascii)
+{
+  if (s.size() != ascii.size())
+    return false;
+  for (std::size_t i = 0; i < s.size(); ++i)
+    if (s[i] != static_cast<CharT>(ascii[i]))
+      return false;
+  return true;
+}
+
+template<typename E, typename CharT, typename ToString>
+void check_char_names(const ToString to_char_string)
+{
+  for (std::size_t i = 0; i < enchantum::count<E>; ++i) {
+    const auto value = enchantum::values<E>[i];
+    const auto name  = to_char_string(value);
+    CHECK(equals_ascii(name, enchantum::names<E>[i]));
+    CHECK(name.data()[name.size()] == CharT{});
+    CHECK((enchantum::names_generator<E, std::basic_string_view<CharT>>[i] == name));
+    CHECK(enchantum::cast<E>(name) == value);
+    CHECK_FALSE(enchantum::cast<E>(name.substr(1)).has_value());
+  }
+}
+
+#if !defined(_MSC_VER)
+enum class Unicode {
+  α,
+  Ωmega,
+  𝔸bc,
+};
+#endif
+} // namespace
+
+TEMPLATE_LIST_TEST_CASE("wide and unicode names", "[char_names]", AllEnumsTestTypes)
+{
+  check_char_names<TestType, wchar_t>(enchantum::to_wstring);
+#ifdef __cpp_char8_t
+  check_char_names<TestType, char8_t>(enchantum::to_u8string);
+#endif
+  check_char_names<TestType, char16_t>(enchantum::to_u16string);
+  check_char_names<TestType, char32_t>(enchantum::to_u32string);
+}
+
+TEST_CASE("wide and unicode names of invalid values", "[char_names]")
+{
+  STATIC_CHECK(enchantum::to_wstring(static_cast<Color>(-41)).empty());
+  STATIC_CHECK(enchantum::to_u16string(Color::Green) == u"Green");
+  STATIC_CHECK(enchantum::to_u32string(Color::Aqua) == U"Aqua");
+  STATIC_CHECK(enchantum::cast<Color>(L"Blue") == Color::Blue);
+  STATIC_CHECK_FALSE(enchantum::cast<Color>(u"Blué").has_value());
+  STATIC_CHECK_FALSE(enchantum::cast<Color>(U"").has_value());
+}
+
+#if !defined(_MSC_VER)
+TEST_CASE("unicode names are transcoded", "[char_names]")
+{
+  STATIC_CHECK(enchantum::to_u16string(Unicode::α) == u"α");
+  STATIC_CHECK(enchantum::to_u16string(Unicode::𝔸bc) == u"𝔸bc");
+  STATIC_CHECK(enchantum::to_u16string(Unicode::𝔸bc).size() == 4);
+  STATIC_CHECK(enchantum::to_u32string(Unicode::𝔸bc).size() == 3);
+  STATIC_CHECK(enchantum::to_wstring(Unicode::Ωmega) == L"Ωmega");
+  STATIC_CHECK(enchantum::cast<Unicode>(u"Ωmega") == Unicode::Ωmega);
+  STATIC_CHECK(enchantum::cast<Unicode>(U"𝔸bc") == Unicode::𝔸bc);
+  STATIC_CHECK_FALSE(enchantum::cast<Unicode>(U"𝔸b").has_value());
+  STATIC_CHECK((enchantum::names_generator<Unicode, std::u32string_view>[1] == U"Ωmega"));
+  #ifdef __cpp_char8_t
+  STATIC_CHECK(enchantum::to_u8string(Unicode::α) == u8"α");
+  #endif
+}
+#endif
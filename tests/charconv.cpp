@@ -0,0 +1,149 @@
+#include "test_utility.hpp"
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <enchantum/bitflags.hpp>
+#include <enchantum/charconv.hpp>
+#include <enchantum/enchantum.hpp>
+#include <array>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <system_error>
+
+namespace {
+template<typename E>
+std::string to_chars_string(const E value, const enchantum::format_options options = {})
+{
+  char       buffer[256];
+  const auto ret = enchantum::to_chars(buffer, buffer + sizeof(buffer), value, options);
+  CHECK(ret.ec == std::errc{});
+  return std::string(buffer, ret.ptr);
+}
+} // namespace
+
+TEMPLATE_LIST_TEST_CASE("to_chars and from_chars round trip", "[to_chars][from_chars]", AllEnumsTestTypes)
+{
+  for (const auto& options : {enchantum::format_options{},
+                              enchantum::format_options{'|', true, false},
+                              enchantum::format_options{'|', false, true}}) {
+    for (const auto value : enchantum::values<TestType>) {
+      const auto s = to_chars_string(value, options);
+      if (!options.scoped && !options.underlying)
+        CHECK(s == std::string(enchantum::to_string(value)));
+
+      TestType   parsed{};
+      const auto ret = enchantum::from_chars(s.data(), s.data() + s.size(), parsed, options);
+      CHECK(ret.ec == std::errc{});
+      CHECK(ret.ptr == s.data() + s.size());
+      CHECK(parsed == value);
+    }
+  }
+}
+
+TEST_CASE("to_chars", "[to_chars]")
+{
+  CHECK(to_chars_string(Color::Green) == "Green");
+  CHECK(to_chars_string(Color(300)) == "300");
+  CHECK(to_chars_string(Color(-300)) == "-300");
+  CHECK(to_chars_string(Flags::Flag0 | Flags::Flag4) == "Flag0|Flag4");
+  CHECK(to_chars_string(Flags::Flag0 | Flags(1u << 7)) == "129");
+  CHECK(to_chars_string(FlagsWithNone::None) == "None");
+  CHECK(to_chars_string(FlagsWithNone::Flag0 | FlagsWithNone::Flag4, {',', true, false}) ==
+        "FlagsWithNone::Flag0,FlagsWithNone::Flag4");
+  CHECK(to_chars_string(Direction2D::Up, {'|', true, false}) == "Direction2D::Up");
+  CHECK(to_chars_string(Direction2D::Up, {'|', false, true}) == "2");
+
+  SECTION("small buffers")
+  {
+    char buffer[5];
+    auto ret = enchantum::to_chars(buffer, buffer + 5, Color::Green);
+    CHECK(ret.ec == std::errc{});
+    CHECK(std::string_view(buffer, 5) == "Green");
+
+    ret = enchantum::to_chars(buffer, buffer + 5, Color::Purple);
+    CHECK(ret.ec == std::errc::value_too_large);
+    CHECK(ret.ptr == buffer + 5);
+
+    ret = enchantum::to_chars(buffer, buffer + 4, Color(-300));
+    CHECK(ret.ec == std::errc{});
+    CHECK(std::string_view(buffer, 4) == "-300");
+
+    ret = enchantum::to_chars(buffer, buffer, Color::Red);
+    CHECK(ret.ec == std::errc::value_too_large);
+  }
+}
+
+TEST_CASE("from_chars", "[from_chars]")
+{
+  const auto parse = [](const std::string_view s, auto& value, const enchantum::format_options options = {}) {
+    const auto ret = enchantum::from_chars(s.data(), s.data() + s.size(), value, options);
+    return std::make_pair(static_cast<std::size_t>(ret.ptr - s.data()), ret.ec);
+  };
+
+  Color color = Color::Aqua;
+  CHECK(parse("Red rest", color) == std::make_pair(std::size_t{3}, std::errc{}));
+  CHECK(color == Color::Red);
+  CHECK(parse("-300", color) == std::make_pair(std::size_t{4}, std::errc{}));
+  CHECK(color == Color(-300));
+
+  color = Color::Aqua;
+  CHECK(parse("Reddish", color) == std::make_pair(std::size_t{3}, std::errc{}));
+  CHECK(parse("Unknown", color) == std::make_pair(std::size_t{0}, std::errc::invalid_argument));
+  CHECK(parse("", color) == std::make_pair(std::size_t{0}, std::errc::invalid_argument));
+  CHECK(parse("-", color) == std::make_pair(std::size_t{0}, std::errc::invalid_argument));
+  CHECK(parse("99999", color) == std::make_pair(std::size_t{5}, std::errc::result_out_of_range));
+  CHECK(parse("-32768", color) == std::make_pair(std::size_t{6}, std::errc{}));
+  CHECK(color == Color(-32768));
+  CHECK(parse("-32769", color) == std::make_pair(std::size_t{6}, std::errc::result_out_of_range));
+  CHECK(color == Color(-32768));
+
+  SECTION("underlying only")
+  {
+    CHECK(parse("Red", color, {'|', false, true}) == std::make_pair(std::size_t{0}, std::errc::invalid_argument));
+  }
+
+  SECTION("scoped")
+  {
+    Direction2D d{};
+    CHECK(parse("Direction2D::Down", d, {'|', true, false}) == std::make_pair(std::size_t{17}, std::errc{}));
+    CHECK(d == Direction2D::Down);
+    CHECK(parse("Down", d, {'|', true, false}) == std::make_pair(std::size_t{0}, std::errc::invalid_argument));
+    CHECK(parse("Direction2D:Down", d, {'|', true, false}) ==
+          std::make_pair(std::size_t{0}, std::errc::invalid_argument));
+  }
+
+  SECTION("bitflags")
+  {
+    Flags f{};
+    CHECK(parse("Flag0|Flag4", f) == std::make_pair(std::size_t{11}, std::errc{}));
+    CHECK(f == (Flags::Flag0 | Flags::Flag4));
+    CHECK(parse("Flag1|Flag2|", f) == std::make_pair(std::size_t{11}, std::errc{}));
+    CHECK(f == (Flags::Flag1 | Flags::Flag2));
+    CHECK(parse("Flag1|Oops", f) == std::make_pair(std::size_t{5}, std::errc{}));
+    CHECK(f == Flags::Flag1);
+    CHECK(parse("Flag1,Flag3", f, {',', false, false}) == std::make_pair(std::size_t{11}, std::errc{}));
+    CHECK(f == (Flags::Flag1 | Flags::Flag3));
+
+    FlagsWithNone n = FlagsWithNone::Flag7;
+    CHECK(parse("FlagsWithNone::None", n, {'|', true, false}) == std::make_pair(std::size_t{19}, std::errc{}));
+    CHECK(n == FlagsWithNone::None);
+  }
+}
+
+TEST_CASE("to_chars and from_chars are constexpr", "[to_chars][from_chars]")
+{
+  constexpr auto written = []() {
+    std::array<char, 16> buffer{};
+    const auto           ret = enchantum::to_chars(buffer.data(), buffer.data() + buffer.size(), Flags::Flag1 | Flags::Flag2);
+    return std::make_pair(buffer, ret.ptr - buffer.data());
+  }();
+  STATIC_CHECK(std::string_view(written.first.data(), static_cast<std::size_t>(written.second)) == "Flag1|Flag2");
+
+  constexpr auto read = []() {
+    constexpr std::string_view s = "Flag3|Flag6";
+    Flags                      f{};
+    (void)enchantum::from_chars(s.data(), s.data() + s.size(), f);
+    return f;
+  }();
+  STATIC_CHECK(read == (Flags::Flag3 | Flags::Flag6));
+}
@@ -0,0 +1,36 @@
+#include "test_utility.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <enchantum/enchantum.hpp>
+#include <array>
+#include <string_view>
+
+namespace {
+// spans several chunks of `ENCHANTUM_REFLECTION_CHUNK_SIZE` with values on both sides of their edges
+enum class Wide : short {
+  First      = -2000,
+  BeforeEdge = -2000 + ENCHANTUM_REFLECTION_CHUNK_SIZE - 1,
+  AfterEdge  = -2000 + ENCHANTUM_REFLECTION_CHUNK_SIZE,
+  Middle     = 0,
+  LastChunk  = 1999,
+  Last       = 2000,
+};
+} // namespace
+
+template<>
+struct enchantum::enum_traits<Wide> {
+  static constexpr int min = -2000;
+  static constexpr int max = 2000;
+};
+
+TEST_CASE("ranges larger than ENCHANTUM_REFLECTION_CHUNK_SIZE are reflected", "[chunked_reflection]")
+{
+  using namespace std::string_view_literals;
+  STATIC_CHECK(enchantum::count<Wide> == 6);
+  STATIC_CHECK(equal_ranges(
+    enchantum::values<Wide>,
+    std::array{Wide::First, Wide::BeforeEdge, Wide::AfterEdge, Wide::Middle, Wide::LastChunk, Wide::Last}));
+  STATIC_CHECK(equal_ranges(enchantum::names<Wide>,
+                            std::array{"First"sv, "BeforeEdge"sv, "AfterEdge"sv, "Middle"sv, "LastChunk"sv, "Last"sv}));
+  STATIC_CHECK(enchantum::cast<Wide>("AfterEdge") == Wide::AfterEdge);
+  STATIC_CHECK(enchantum::to_string(Wide::BeforeEdge) == "BeforeEdge");
+}
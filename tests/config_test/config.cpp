@@ -12,6 +12,11 @@ namespace {
   _constinit,
   _const
 };
+enum class Discovered : short {
+  Low  = -200,
+  Zero = 0,
+  High = 130,
+};
 } // namespace
 
 template<>
@@ -24,4 +29,20 @@ TEST_CASE("Config")
 {
   tests::my_optional<Keywords> keyword = enchantum::cast<Keywords>(enchantum::to_string(Keywords::_constexpr));
   CHECK(*keyword == Keywords::_constexpr);
-}
\ No newline at end of file
+}
+
+TEST_CASE("Config reflects a range larger than ENCHANTUM_REFLECTION_CHUNK_SIZE")
+{
+  STATIC_CHECK(enchantum::count<Keywords> == 4);
+  CHECK(enchantum::to_string(Keywords::_constinit) == "constinit");
+  CHECK(enchantum::to_string(Keywords::_const) == "const");
+}
+
+TEST_CASE("Config reflects only the blocks having values")
+{
+  STATIC_CHECK(enchantum::count<Discovered> == 3);
+  STATIC_CHECK(enchantum::min<Discovered> == Discovered::Low);
+  STATIC_CHECK(enchantum::max<Discovered> == Discovered::High);
+  CHECK(enchantum::to_string(Discovered::Zero) == "Zero");
+  CHECK(*enchantum::cast<Discovered>("High") == Discovered::High);
+}
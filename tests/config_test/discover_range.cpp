@@ -0,0 +1,71 @@
+#include <enchantum/enchantum.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+enum class FarApart : short {
+  Low  = -120,
+  High = 100,
+};
+
+enum class OneBlock : short {
+  A = 10,
+  B = 20,
+};
+
+enum class Empty : short {};
+
+#ifdef ENCHANTUM_DETAILS_DISCOVER_RANGE
+// what `reflect_range` discovers for the default range of `E`
+template<typename E>
+constexpr auto discovered_range()
+{
+  using namespace enchantum::details;
+  constexpr auto min  = enchantum::enum_traits<E>::min;
+  constexpr auto size = get_index_sequence_max(false, true, sizeof(E), min, enchantum::enum_traits<E>::max, true);
+  return discover_range<E, min, size>(std::make_index_sequence<reflection_chunk_count(size, discovery_block_size)>{});
+}
+
+#endif
+} // namespace
+
+#ifdef ENCHANTUM_DETAILS_DISCOVER_RANGE
+TEST_CASE("Discovery probes the default range in blocks of ENCHANTUM_DISCOVER_RANGE_BLOCK_SIZE")
+{
+  STATIC_CHECK(enchantum::details::discovery_block_size == 64);
+  STATIC_CHECK(enchantum::enum_traits<FarApart>::min == -256);
+  STATIC_CHECK(enchantum::enum_traits<FarApart>::max == 256);
+}
+
+TEST_CASE("Discovery reflects only the blocks from the first to the last value")
+{
+  // -120 is in the block [-128,-65] and 100 in [64,127]
+  constexpr auto far_apart = discovered_range<FarApart>();
+  STATIC_CHECK(far_apart.first == 128);
+  STATIC_CHECK(far_apart.size == 256);
+
+  // 10 and 20 are both in the block [0,63]
+  constexpr auto one_block = discovered_range<OneBlock>();
+  STATIC_CHECK(one_block.first == 256);
+  STATIC_CHECK(one_block.size == 64);
+
+  // nothing found, the first block is reflected to find nothing
+  constexpr auto empty = discovered_range<Empty>();
+  STATIC_CHECK(empty.first == 0);
+  STATIC_CHECK(empty.size == 64);
+}
+
+TEST_CASE("Discovery reflects the same entries as the whole range")
+{
+  STATIC_CHECK(enchantum::count<FarApart> == 2);
+  STATIC_CHECK(enchantum::min<FarApart> == FarApart::Low);
+  STATIC_CHECK(enchantum::max<FarApart> == FarApart::High);
+  STATIC_CHECK(enchantum::count<OneBlock> == 2);
+  CHECK(enchantum::to_string(FarApart::Low) == "Low");
+  CHECK(enchantum::to_string(FarApart::High) == "High");
+  CHECK(*enchantum::cast<FarApart>("High") == FarApart::High);
+  CHECK(enchantum::to_string(OneBlock::B) == "B");
+  CHECK_FALSE(enchantum::cast<FarApart>(0).has_value());
+}
+#endif
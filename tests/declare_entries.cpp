@@ -0,0 +1,71 @@
+#include "declared_entries_generated.hpp"
+#include "test_utility.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <enchantum/bitflags.hpp>
+#include <enchantum/enchantum.hpp>
+#include <array>
+#include <string_view>
+
+namespace {
+enum class Declared : short {
+  A = -1,
+  B = 7,
+  C = 1000,
+};
+} // namespace
+
+// the names do not have to be the enumerator names
+ENCHANTUM_DECLARE_ENTRIES(Declared, {Declared::A, "A"}, {Declared::B, "Bee"}, {Declared::C, "C"});
+
+TEST_CASE("ENCHANTUM_DECLARE_ENTRIES", "[declare_entries]")
+{
+  using namespace std::string_view_literals;
+  STATIC_CHECK(enchantum::count<Declared> == 3);
+  STATIC_CHECK(equal_ranges(enchantum::values<Declared>, std::array{Declared::A, Declared::B, Declared::C}));
+  STATIC_CHECK(equal_ranges(enchantum::names<Declared>, std::array{"A"sv, "Bee"sv, "C"sv}));
+  STATIC_CHECK(equal_ranges(enchantum::names<Declared, std::string_view, false>, std::array{"A"sv, "Bee"sv, "C"sv}));
+  STATIC_CHECK(enchantum::min<Declared> == Declared::A);
+  STATIC_CHECK(enchantum::max<Declared> == Declared::C);
+  STATIC_CHECK(enchantum::to_string(Declared::B) == "Bee");
+  STATIC_CHECK(enchantum::cast<Declared>("Bee") == Declared::B);
+  STATIC_CHECK_FALSE(enchantum::cast<Declared>("B").has_value());
+  STATIC_CHECK(enchantum::enum_to_index(Declared::C) == 2);
+  STATIC_CHECK_FALSE(enchantum::contains(static_cast<Declared>(0)));
+}
+
+TEST_CASE("ENCHANTUM_DECLARE_ENTRIES checks the declared entries", "[declare_entries]")
+{
+  // what the static_asserts of ENCHANTUM_DECLARE_ENTRIES evaluate
+  using Declarations = std::array<std::pair<Declared, enchantum::string_view>, 3>;
+  constexpr Declarations sorted{{{Declared::A, "A"}, {Declared::B, "B"}, {Declared::C, "C"}}};
+  constexpr Declarations unsorted{{{Declared::B, "B"}, {Declared::A, "A"}, {Declared::C, "C"}}};
+  constexpr Declarations duplicate_value{{{Declared::A, "A"}, {Declared::A, "B"}, {Declared::C, "C"}}};
+  constexpr Declarations duplicate_name{{{Declared::A, "A"}, {Declared::B, "C"}, {Declared::C, "C"}}};
+  constexpr Declarations empty_name{{{Declared::A, "A"}, {Declared::B, ""}, {Declared::C, "C"}}};
+
+  STATIC_CHECK(enchantum::details::are_declared_values_ascending(sorted));
+  STATIC_CHECK(enchantum::details::are_declared_names_unique(sorted));
+  STATIC_CHECK_FALSE(enchantum::details::are_declared_values_ascending(unsorted));
+  STATIC_CHECK_FALSE(enchantum::details::are_declared_values_ascending(duplicate_value));
+  STATIC_CHECK_FALSE(enchantum::details::are_declared_names_unique(duplicate_name));
+  STATIC_CHECK_FALSE(enchantum::details::are_declared_names_unique(empty_name));
+}
+
+TEST_CASE("enchantum_generate_entries", "[declare_entries]")
+{
+  using namespace std::string_view_literals;
+  STATIC_CHECK(enchantum::details::has_declared_entries<GeneratedColor>);
+  STATIC_CHECK(equal_ranges(
+    enchantum::values<GeneratedColor>,
+    std::array{GeneratedColor::Smallest, GeneratedColor::Red, GeneratedColor::Green, GeneratedColor::Blue}));
+  STATIC_CHECK(equal_ranges(enchantum::names<GeneratedColor>, std::array{"Smallest"sv, "Red"sv, "Green"sv, "Blue"sv}));
+
+  STATIC_CHECK(enchantum::details::has_declared_entries<generated::Unscoped>);
+  STATIC_CHECK(enchantum::to_string(generated::Last) == "Last");
+  STATIC_CHECK(enchantum::cast<generated::Unscoped>(200) == generated::Last);
+
+  STATIC_CHECK(enchantum::details::has_declared_entries<generated::Flags>);
+  STATIC_CHECK(enchantum::count<generated::Flags> == 4);
+  CHECK(enchantum::to_string_bitflag(generated::Flags::A | generated::Flags::C) == "A|C");
+  STATIC_CHECK(enchantum::cast_bitflag<generated::Flags>("B|C") == (generated::Flags::B | generated::Flags::C));
+}
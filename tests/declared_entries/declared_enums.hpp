@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <enchantum/bitwise_operators.hpp>
+
+// the enums `enchantum_generate_entries` declares the entries of in tests/CMakeLists.txt
+
+enum class GeneratedColor : std::int8_t {
+  Smallest = INT8_MIN,
+  Red      = -3,
+  Green    = 0,
+  Blue     = 40,
+};
+
+namespace generated {
+enum Unscoped : unsigned short {
+  First  = 1,
+  Second = 2,
+  Last   = 200,
+};
+
+enum class Flags : std::uint8_t {
+  None = 0,
+  A    = 1 << 0,
+  B    = 1 << 1,
+  C    = 1 << 7,
+};
+ENCHANTUM_DEFINE_BITWISE_FOR(Flags)
+} // namespace generated
@@ -572,6 +572,13 @@ TEST_CASE("Color enum cast with custom binary predicate (case insensitive)", "[c
   STATIC_CHECK(enchantum::cast<Color>("purple", case_insensitive_both) == Color::Purple);
   STATIC_CHECK(enchantum::cast<Color>("AQUA", case_insensitive_both) == Color::Aqua);
   STATIC_CHECK_FALSE(enchantum::cast<Color>("zxSHADY", case_insensitive_both));
+
+  STATIC_CHECK(enchantum::cast<Color>("green", enchantum::ascii_case_insensitive) == Color::Green);
+  STATIC_CHECK(enchantum::cast<Color>("RED", enchantum::ascii_case_insensitive) == Color::Red);
+  STATIC_CHECK(enchantum::cast<Color>("bLuE", enchantum::ascii_case_insensitive) == Color::Blue);
+  STATIC_CHECK(enchantum::cast<Color>("purple", enchantum::ascii_case_insensitive) == Color::Purple);
+  STATIC_CHECK(enchantum::cast<Color>("AQUA", enchantum::ascii_case_insensitive) == Color::Aqua);
+  STATIC_CHECK_FALSE(enchantum::cast<Color>("zxSHADY", enchantum::ascii_case_insensitive));
 }
 
 TEST_CASE("Color enum index_to_enum", "[index_to_enum]")
@@ -0,0 +1,82 @@
+// everything used here compiles without the names of the extern enums,
+// evaluating them here would fail the static_assert of ENCHANTUM_EXTERN_REFLECTION
+#include "extern_enums.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <enchantum/batch.hpp>
+#include <enchantum/bitflags.hpp>
+#include <enchantum/bitset.hpp>
+#include <enchantum/enchantum.hpp>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+
+TEST_CASE("extern reflection keeps values constexpr", "[extern_reflection]")
+{
+  STATIC_CHECK(enchantum::count<ExternColor> == 4);
+  STATIC_CHECK(enchantum::min<ExternColor> == ExternColor::Red);
+  STATIC_CHECK(enchantum::max<ExternColor> == ExternColor::Purple);
+  STATIC_CHECK(enchantum::values<ExternColor>[2] == ExternColor::Blue);
+  STATIC_CHECK(enchantum::enum_to_index(ExternColor::Purple) == 3);
+  STATIC_CHECK(enchantum::contains(ExternColor::Green));
+  STATIC_CHECK_FALSE(enchantum::contains(static_cast<ExternColor>(1)));
+  STATIC_CHECK(enchantum::cast<ExternColor>(short{4}) == ExternColor::Blue);
+  STATIC_CHECK(enchantum::count<externs::Unscoped> == 3);
+  STATIC_CHECK(enchantum::count<externs::Flags> == 4);
+  STATIC_CHECK(enchantum::contains_bitflag(externs::Flags::Read | externs::Flags::Exec));
+}
+
+TEST_CASE("extern reflection names", "[extern_reflection]")
+{
+  CHECK(enchantum::to_string(ExternColor::Red) == "Red");
+  CHECK(enchantum::to_string(ExternColor::Purple) == "Purple");
+  CHECK(enchantum::to_string(static_cast<ExternColor>(1)).empty());
+  CHECK(enchantum::to_string_unchecked(ExternColor::Blue) == "Blue");
+  CHECK(enchantum::to_string(externs::Second) == "Second");
+
+  CHECK(enchantum::cast<ExternColor>("Green") == ExternColor::Green);
+  CHECK(enchantum::cast<externs::Unscoped>("Third") == externs::Third);
+  CHECK_FALSE(enchantum::cast<ExternColor>("Gree").has_value());
+  CHECK(enchantum::contains<ExternColor>("Purple"));
+  CHECK_FALSE(enchantum::contains<ExternColor>("purple"));
+
+  CHECK(enchantum::cast<ExternColor>("pURPLE", enchantum::ascii_case_insensitive) == ExternColor::Purple);
+  CHECK(enchantum::contains<ExternColor>("blue", enchantum::ascii_case_insensitive));
+}
+
+TEST_CASE("extern reflection cast_batch", "[extern_reflection]")
+{
+  const std::array<std::string_view, 3> inputs{"Blue", "Pink", "Red"};
+  std::array<ExternColor, 3>            out{};
+  std::array<std::uint8_t, 1>           validity{};
+  CHECK(enchantum::cast_batch<ExternColor>(inputs.begin(), inputs.end(), out.data(), validity.data()) == 2);
+  CHECK(out[0] == ExternColor::Blue);
+  CHECK(out[2] == ExternColor::Red);
+  CHECK(validity[0] == 0b101);
+}
+
+TEST_CASE("extern reflection bitflags", "[extern_reflection]")
+{
+  using externs::Flags;
+  CHECK(enchantum::to_string_bitflag(Flags::Read | Flags::Exec) == "Read|Exec");
+  CHECK(enchantum::to_string_bitflag(Flags::None) == "None");
+  CHECK(enchantum::to_string_bitflag(static_cast<Flags>(1 << 5)).empty());
+
+  std::string out;
+  enchantum::to_string_bitflag(std::back_inserter(out), Flags::Write | Flags::Exec, ',');
+  CHECK(out == "Write,Exec");
+
+  CHECK(enchantum::cast_bitflag<Flags>("Write|Read") == (Flags::Read | Flags::Write));
+  CHECK(enchantum::cast_bitflag<Flags>("write|read", '|', enchantum::ascii_case_insensitive) ==
+        (Flags::Read | Flags::Write));
+  CHECK_FALSE(enchantum::cast_bitflag<Flags>("Write|Reed").has_value());
+  CHECK(enchantum::parse_bitflag<Flags>(" Exec | Read ").value == (Flags::Read | Flags::Exec));
+
+  std::string names;
+  for (const auto& [value, name] : enchantum::flag_entries_of(Flags::Read | Flags::Write))
+    names.append(name.data(), name.size());
+  CHECK(names == "ReadWrite");
+
+  CHECK(enchantum::bitset<ExternColor>{ExternColor::Red, ExternColor::Purple}.to_string() == "Red|Purple");
+}
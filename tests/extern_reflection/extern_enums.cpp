@@ -0,0 +1,6 @@
+#include "extern_enums.hpp"
+
+// the only translation unit evaluating the names of these enums
+ENCHANTUM_DEFINE_REFLECTION(ExternColor)
+ENCHANTUM_DEFINE_REFLECTION(externs::Unscoped)
+ENCHANTUM_DEFINE_REFLECTION(externs::Flags)
@@ -0,0 +1,30 @@
+#pragma once
+#include <enchantum/bitwise_operators.hpp>
+#include <enchantum/enchantum.hpp>
+#include <cstdint>
+
+enum class ExternColor : short {
+  Red    = -3,
+  Green  = 0,
+  Blue   = 4,
+  Purple = 100,
+};
+ENCHANTUM_EXTERN_REFLECTION(ExternColor);
+
+namespace externs {
+enum Unscoped {
+  First,
+  Second,
+  Third,
+};
+
+enum class Flags : std::uint8_t {
+  None  = 0,
+  Read  = 1 << 0,
+  Write = 1 << 1,
+  Exec  = 1 << 3,
+};
+ENCHANTUM_DEFINE_BITWISE_FOR(Flags)
+} // namespace externs
+ENCHANTUM_EXTERN_REFLECTION(externs::Unscoped);
+ENCHANTUM_EXTERN_REFLECTION(externs::Flags);
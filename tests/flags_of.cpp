@@ -0,0 +1,70 @@
+#include "test_utility.hpp"
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <enchantum/bitflags.hpp>
+#include <enchantum/bitwise_operators.hpp>
+#include <enchantum/enchantum.hpp>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// not in an anonymous namespace so clang does not warn about the operators left unused
+enum class SparseFlags : std::uint32_t {
+  A = 1u << 3,
+  B = 1u << 9,
+  C = 1u << 17,
+  D = 1u << 31,
+};
+ENCHANTUM_DEFINE_BITWISE_FOR(SparseFlags)
+
+TEMPLATE_LIST_TEST_CASE("flags_of visits every flag of value_ors", "[bitflags][flags_of]", AllFlagsTestTypes)
+{
+  std::vector<TestType> expected;
+  for (const auto v : enchantum::values<TestType>)
+    if (enchantum::to_underlying(v) != 0)
+      expected.push_back(v);
+
+  std::vector<TestType> flags;
+  for (const auto v : enchantum::flags_of(enchantum::value_ors<TestType>))
+    flags.push_back(v);
+  CHECK(flags == expected);
+
+  std::size_t i = 0;
+  for (const auto& [value, name] : enchantum::flag_entries_of(enchantum::value_ors<TestType>)) {
+    CHECK(value == expected[i]);
+    CHECK(name == enchantum::to_string(expected[i]));
+    ++i;
+  }
+  CHECK(enchantum::flags_of(TestType{}).empty());
+}
+
+TEST_CASE("flags_of", "[bitflags][flags_of]")
+{
+  const auto collect = [](auto value) {
+    std::vector<decltype(value)> ret;
+    for (const auto v : enchantum::flags_of(value))
+      ret.push_back(v);
+    return ret;
+  };
+
+  CHECK(collect(Flags::Flag1 | Flags::Flag4) == std::vector<Flags>{Flags::Flag1, Flags::Flag4});
+  CHECK(collect(Flags::Flag1 | Flags(1u << 7)) == std::vector<Flags>{Flags::Flag1});
+  CHECK(collect(SparseFlags::D | SparseFlags::A | SparseFlags::C) ==
+        std::vector<SparseFlags>{SparseFlags::A, SparseFlags::C, SparseFlags::D});
+  CHECK(collect(FlagsWithNone::None).empty());
+}
+
+TEST_CASE("flags_of is constexpr", "[bitflags][flags_of]")
+{
+  constexpr auto sum = []() {
+    std::uint32_t ret = 0;
+    for (const auto [value, name] : enchantum::flag_entries_of(SparseFlags::B | SparseFlags::D))
+      ret += static_cast<std::uint32_t>(name.size()) + static_cast<std::uint32_t>(enchantum::to_underlying(value) != 0);
+    return ret;
+  }();
+  STATIC_CHECK(sum == 4);
+
+  constexpr auto range = enchantum::flags_of(SparseFlags::C);
+  STATIC_CHECK(*range.begin() == SparseFlags::C);
+  STATIC_CHECK(std::next(range.begin()) == range.end());
+}
@@ -55,3 +55,40 @@ TEST_CASE("Flags enum fmt::format", "[stringify][fmt_format]")
     CHECK(fmt::format("{}", enchantum::value_ors<Flags>) == "Flag0|Flag1|Flag2|Flag3|Flag4|Flag5|Flag6");
   }
 }
+
+
+TEST_CASE("fmt::format enchantum options", "[stringify][fmt_format]")
+{
+  SECTION("scoped")
+  {
+    CHECK(fmt::format("{:S}", Direction2D::Up) == "Direction2D::Up");
+    CHECK(fmt::format("{:S}", FlagsWithNone::None) == "FlagsWithNone::None");
+    CHECK(fmt::format("{:S}", FlagsWithNone::Flag0 | FlagsWithNone::Flag4) == "FlagsWithNone::Flag0|FlagsWithNone::Flag4");
+    CHECK(fmt::format("{:S}", Direction2D(123)) == "123");
+  }
+  SECTION("underlying")
+  {
+    CHECK(fmt::format("{:d}", Color::Green) == fmt::format("{}", enchantum::to_underlying(Color::Green)));
+    CHECK(fmt::format("{:d}", Flags::Flag0 | Flags::Flag4) == "17");
+    CHECK(fmt::format("{:Sd}", Color::Green) == fmt::format("{}", enchantum::to_underlying(Color::Green)));
+  }
+  SECTION("separator")
+  {
+    CHECK(fmt::format("{:/,}", Flags::Flag0 | Flags::Flag4) == "Flag0,Flag4");
+    CHECK(fmt::format("{:S/ }", FlagsWithNone::Flag0 | FlagsWithNone::Flag4) == "FlagsWithNone::Flag0 FlagsWithNone::Flag4");
+    CHECK(fmt::format("{:/,}", Flags::Flag1) == "Flag1");
+  }
+  SECTION("standard spec")
+  {
+    CHECK(fmt::format("{:>7}", Color::Red) == "    Red");
+    CHECK(fmt::format("{:S*^21}", Direction2D::Down) == "**Direction2D::Down**");
+    CHECK(fmt::format("{:/,<13}", Flags::Flag0 | Flags::Flag4) == "Flag0,Flag4  ");
+    CHECK(fmt::format("{:.3}", Color::Purple) == "Pur");
+  }
+  SECTION("option characters as fill")
+  {
+    CHECK(fmt::format("{:S<6}", Color::Red) == "RedSSS");
+    CHECK(fmt::format("{:d>5}", Color::Red) == "ddRed");
+    CHECK(fmt::format("{:S/>12}", Color::Red) == "//Color::Red");
+  }
+}
@@ -3,7 +3,9 @@
 #include <catch2/catch_test_macros.hpp>
 #include <enchantum/enchantum.hpp>
 #include <enchantum/iostream.hpp>
+#include <iomanip>
 #include <sstream>
+#include <string>
 
 using namespace enchantum::iostream_operators;
 
@@ -61,3 +63,98 @@ TEST_CASE("ostream operator<< return numbers if invalid enum", "[ostream]")
   CHECK(tostringoss(Flags::Flag0 | Flags::Flag1) == "Flag0|Flag1");
   CHECK(tostringoss(Flags::Flag0 | Flags(1u << 7)) == std::to_string(1 | (1u << 7)));
 }
+
+TEST_CASE("iostream operators formatting and token boundaries", "[iostream]")
+{
+  SECTION("ostream padding")
+  {
+    auto oss = std::ostringstream();
+    oss << std::setw(6) << Color::Red << '|' << std::left << std::setfill('*') << std::setw(7) << Color::Blue;
+    CHECK(oss.str() == "   Red|Blue***");
+  }
+  SECTION("several tokens")
+  {
+    auto  iss = std::istringstream("  Red\tBlue\n Flag0|Flag4 Green");
+    Color a{}, b{}, c{};
+    Flags f{};
+    iss >> a >> b >> f >> c;
+    CHECK(iss);
+    CHECK(a == Color::Red);
+    CHECK(b == Color::Blue);
+    CHECK(f == (Flags::Flag0 | Flags::Flag4));
+    CHECK(c == Color::Green);
+    CHECK(iss.eof());
+  }
+  SECTION("stops at whitespace")
+  {
+    auto  iss = std::istringstream("Purple rest");
+    Color a{};
+    iss >> a;
+    CHECK(a == Color::Purple);
+    std::string rest;
+    iss >> rest;
+    CHECK(rest == "rest");
+  }
+  SECTION("tokens longer than any name fail and are consumed")
+  {
+    auto  iss = std::istringstream(std::string(1000, 'R') + " Red");
+    Color a{};
+    iss >> a;
+    CHECK_FALSE(iss);
+    iss.clear();
+    iss >> a;
+    CHECK(iss);
+    CHECK(a == Color::Red);
+  }
+  SECTION("repeated flags are accepted like cast_bitflag does")
+  {
+    std::string repeated;
+    for (int i = 0; i < 100; ++i)
+      repeated += "Flag0|Flag1|";
+    repeated += "Flag4";
+    REQUIRE(enchantum::cast_bitflag<Flags>(repeated) == (Flags::Flag0 | Flags::Flag1 | Flags::Flag4));
+
+    auto  iss = std::istringstream("Flag0|Flag1|Flag0|Flag1 " + repeated + " Flag0||Flag1 Flag0| Flag2");
+    Flags a{}, b{};
+    iss >> a >> b;
+    CHECK(iss);
+    CHECK(a == (Flags::Flag0 | Flags::Flag1));
+    CHECK(b == (Flags::Flag0 | Flags::Flag1 | Flags::Flag4));
+
+    Flags c = Flags::Flag3;
+    iss >> c;
+    CHECK_FALSE(iss);
+    iss.clear();
+    iss >> c;
+    CHECK_FALSE(iss);
+    CHECK(c == Flags::Flag3);
+    iss.clear();
+    iss >> c;
+    CHECK(iss);
+    CHECK(c == Flags::Flag2);
+  }
+  SECTION("width limits the characters read")
+  {
+    auto  iss = std::istringstream("RedBlue Green");
+    Color a{}, b{};
+    iss >> std::setw(3) >> a >> b;
+    CHECK(iss);
+    CHECK(a == Color::Red);
+    CHECK(b == Color::Blue);
+    CHECK(iss.width() == 0);
+
+    Color c = Color::Red;
+    iss >> std::setw(2) >> c;
+    CHECK_FALSE(iss);
+    CHECK(c == Color::Red);
+  }
+  SECTION("empty input")
+  {
+    auto  iss = std::istringstream("   ");
+    Color a = Color::Red;
+    iss >> a;
+    CHECK_FALSE(iss);
+    CHECK(iss.eof());
+    CHECK(a == Color::Red);
+  }
+}
@@ -0,0 +1,62 @@
+#include <catch2/catch_test_macros.hpp>
+#include <enchantum/enchantum.hpp>
+#include <string_view>
+
+#define LONG_NAMES_CAT_(a, b) a##b
+#define LONG_NAMES_CAT(a, b)  LONG_NAMES_CAT_(a, b)
+#define LONG_NAMES_100        Abcdefghijklmnopqrstuvwxyz_abcdefghijklmnopqrstuvwxyz_abcdefghijklmnopqrstuvwxyz_abcdefghijklmnopqrs
+// a 300 character name followed by `Suffix`
+#define LONG_NAME(Suffix) \
+  LONG_NAMES_CAT(LONG_NAMES_CAT(LONG_NAMES_CAT(LONG_NAMES_CAT(LONG_NAMES_100, LONG_NAMES_100), LONG_NAMES_100), _), Suffix)
+
+namespace {
+// names longer than 255 characters adding up to more than 8 KB
+enum class LongNames {
+  LONG_NAME(0),
+  LONG_NAME(1),
+  LONG_NAME(2),
+  LONG_NAME(3),
+  LONG_NAME(4),
+  LONG_NAME(5),
+  LONG_NAME(6),
+  LONG_NAME(7),
+  LONG_NAME(8),
+  LONG_NAME(9),
+  LONG_NAME(10),
+  LONG_NAME(11),
+  LONG_NAME(12),
+  LONG_NAME(13),
+  LONG_NAME(14),
+  LONG_NAME(15),
+  LONG_NAME(16),
+  LONG_NAME(17),
+  LONG_NAME(18),
+  LONG_NAME(19),
+  LONG_NAME(20),
+  LONG_NAME(21),
+  LONG_NAME(22),
+  LONG_NAME(23),
+  LONG_NAME(24),
+  LONG_NAME(25),
+  LONG_NAME(26),
+  LONG_NAME(27),
+  LONG_NAME(28),
+  LONG_NAME(29),
+  Short,
+};
+} // namespace
+
+TEST_CASE("names longer than 255 characters", "[long_names]")
+{
+  // the 300 characters, `_` and a single digit
+  constexpr std::size_t long_name_size = 300 + 1 + 1;
+  STATIC_CHECK(enchantum::count<LongNames> == 31);
+  STATIC_CHECK(enchantum::to_string(LongNames::LONG_NAME(0)).size() == long_name_size);
+  STATIC_CHECK(enchantum::to_string(LongNames::LONG_NAME(29)).size() == long_name_size + 1);
+  STATIC_CHECK(enchantum::to_string(LongNames::LONG_NAME(29)).substr(300) == "_29");
+  STATIC_CHECK(enchantum::to_string(LongNames::LONG_NAME(7)).substr(0, 3) == "Abc");
+  STATIC_CHECK(enchantum::to_string(LongNames::Short) == "Short");
+  STATIC_CHECK(enchantum::cast<LongNames>(enchantum::to_string(LongNames::LONG_NAME(17))) == LongNames::LONG_NAME(17));
+  STATIC_CHECK_FALSE(enchantum::cast<LongNames>(enchantum::to_string(LongNames::LONG_NAME(17)).substr(1)).has_value());
+  STATIC_CHECK(enchantum::names<LongNames>[30] == "Short");
+}
@@ -0,0 +1,48 @@
+#include <catch2/catch_test_macros.hpp>
+#include <enchantum/bitwise_operators.hpp> // for ENCHANTUM_DEFINE_BITWISE_FOR
+#include <cstdint>
+#include <string>
+
+import enchantum;
+
+// everything used here has to be exported by enchantum/module/enchantum.cppm
+enum class Color : std::uint8_t {
+  Red,
+  Green,
+  Blue,
+};
+
+enum class Access : std::uint8_t {
+  None  = 0,
+  Read  = 1 << 0,
+  Write = 1 << 1,
+  Exec  = 1 << 2,
+};
+ENCHANTUM_DEFINE_BITWISE_FOR(Access)
+
+TEST_CASE("import enchantum", "[module]")
+{
+  STATIC_CHECK(enchantum::count<Color> == 3);
+  STATIC_CHECK(enchantum::to_string(Color::Green) == "Green");
+  STATIC_CHECK(enchantum::cast<Color>("Blue") == Color::Blue);
+  STATIC_CHECK_FALSE(enchantum::cast<Color>("Purple").has_value());
+  STATIC_CHECK(enchantum::contains<Color>("Red"));
+  STATIC_CHECK(enchantum::enum_to_index(Color::Blue) == 2);
+}
+
+TEST_CASE("import enchantum scoped", "[module]")
+{
+  CHECK(enchantum::scoped::to_string(Color::Red) == "Color::Red");
+  CHECK(enchantum::scoped::cast<Color>("Color::Green") == Color::Green);
+  CHECK(enchantum::scoped::contains<Color>("Color::Blue"));
+  CHECK_FALSE(enchantum::scoped::contains<Color>("Blue"));
+}
+
+TEST_CASE("import enchantum bitflags", "[module]")
+{
+  STATIC_CHECK(enchantum::is_bitflag<Access>);
+  CHECK(enchantum::to_string_bitflag(Access::Read | Access::Exec) == "Read|Exec");
+  STATIC_CHECK(enchantum::cast_bitflag<Access>("Read|Write") == (Access::Read | Access::Write));
+  STATIC_CHECK(enchantum::contains_bitflag(Access::Read | Access::Write));
+  STATIC_CHECK_FALSE(enchantum::cast_bitflag<Access>("Read|Other").has_value());
+}
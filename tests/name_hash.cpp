@@ -0,0 +1,83 @@
+#include "test_utility.hpp"
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <enchantum/enchantum.hpp>
+#include <string>
+
+TEMPLATE_LIST_TEST_CASE("name hash table is perfect", "[cast][name_hash]", AllEnumsTestTypes)
+{
+  constexpr auto& table = enchantum::details::name_hash_table<TestType>;
+  STATIC_CHECK(table.valid);
+
+  for (std::size_t i = 0; i < enchantum::count<TestType>; ++i) {
+    const auto name = enchantum::names<TestType>[i];
+    const auto slot = table.slot_of(enchantum::details::hash_string(name.data(), name.size()));
+    CHECK(table.slots[slot] == i);
+    CHECK(enchantum::details::hashed_name_index<TestType>(name) == i);
+
+    std::string miss(name);
+    miss += '_';
+    CHECK(enchantum::details::hashed_name_index<TestType>(miss) == enchantum::count<TestType>);
+    miss.pop_back();
+    miss.back() = '?';
+    CHECK(enchantum::details::hashed_name_index<TestType>(miss) == enchantum::count<TestType>);
+  }
+  CHECK(enchantum::details::hashed_name_index<TestType>("") == enchantum::count<TestType>);
+}
+
+TEST_CASE("Letters cast through name hash", "[cast][name_hash]")
+{
+  STATIC_CHECK(enchantum::details::has_name_hash_table<Letters>);
+  STATIC_CHECK(enchantum::cast<Letters>("a") == Letters::a);
+  STATIC_CHECK(enchantum::cast<Letters>("q") == Letters::q);
+  STATIC_CHECK(enchantum::cast<Letters>("z") == Letters::z);
+  STATIC_CHECK(enchantum::contains<Letters>("m"));
+  STATIC_CHECK_FALSE(enchantum::cast<Letters>("A"));
+  STATIC_CHECK_FALSE(enchantum::contains<Letters>("?"));
+}
+
+namespace {
+enum class CaseCollisions {
+  a,
+  b,
+  c,
+  d,
+  e,
+  f,
+  g,
+  A,
+};
+} // namespace
+
+TEMPLATE_LIST_TEST_CASE("ascii_case_insensitive cast and contains", "[cast][name_hash]", AllEnumsTestTypes)
+{
+  for (std::size_t i = 0; i < enchantum::count<TestType>; ++i) {
+    std::string upper(enchantum::names<TestType>[i]);
+    std::string lower = upper;
+    for (auto& c : upper)
+      c = static_cast<char>(c >= 'a' && c <= 'z' ? c - ('a' - 'A') : c);
+    for (auto& c : lower)
+      c = static_cast<char>(c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c);
+
+    CHECK(enchantum::cast<TestType>(upper, enchantum::ascii_case_insensitive) == enchantum::values<TestType>[i]);
+    CHECK(enchantum::cast<TestType>(lower, enchantum::ascii_case_insensitive) == enchantum::values<TestType>[i]);
+    CHECK(enchantum::contains<TestType>(upper, enchantum::ascii_case_insensitive));
+    CHECK_FALSE(enchantum::contains<TestType>(upper + '_', enchantum::ascii_case_insensitive));
+    CHECK_FALSE(enchantum::cast<TestType>(lower + '_', enchantum::ascii_case_insensitive));
+  }
+}
+
+TEST_CASE("ascii_case_insensitive with folded names that collide", "[cast][name_hash]")
+{
+  STATIC_CHECK(enchantum::details::has_name_hash_table<CaseCollisions>);
+  STATIC_CHECK_FALSE(enchantum::details::has_name_hash_table<CaseCollisions, true>);
+
+  // falls back to comparing every name in order
+  STATIC_CHECK(enchantum::cast<CaseCollisions>("A", enchantum::ascii_case_insensitive) == CaseCollisions::a);
+  STATIC_CHECK(enchantum::cast<CaseCollisions>("G", enchantum::ascii_case_insensitive) == CaseCollisions::g);
+  STATIC_CHECK(enchantum::cast<CaseCollisions>("A") == CaseCollisions::A);
+
+  STATIC_CHECK(enchantum::details::has_name_hash_table<Letters, true>);
+  STATIC_CHECK(enchantum::cast<Letters>("Q", enchantum::ascii_case_insensitive) == Letters::q);
+  STATIC_CHECK_FALSE(enchantum::cast<Letters>("?", enchantum::ascii_case_insensitive));
+}
@@ -23,4 +23,11 @@ TEMPLATE_LIST_TEST_CASE("entries<E> strings null-terminated character arrays", "
       names_ptr += name.size();
     }
   }
+
+  SECTION("Same names in both layouts")
+  {
+    constexpr auto names               = enchantum::names<TestType>;
+    constexpr auto not_null_terminated = enchantum::names<TestType, std::string_view, false>;
+    STATIC_CHECK(equal_ranges(names, not_null_terminated));
+  }
 }
@@ -0,0 +1,149 @@
+#include "test_utility.hpp"
+#include <algorithm>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <enchantum/prefix.hpp>
+#include <string>
+#include <vector>
+
+enum DuplicateNames {
+  First_a,
+  First_b,
+  First_c,
+  First_d,
+  Again_a,
+  Again_b,
+  Again_c,
+  Again_d,
+};
+
+template<>
+struct enchantum::enum_traits<DuplicateNames> {
+  static constexpr std::size_t prefix_length = sizeof("First_") - 1;
+  static constexpr auto        min           = 0;
+  static constexpr auto        max           = 7;
+};
+
+TEMPLATE_LIST_TEST_CASE("sorted names", "[cast][prefix]", AllEnumsTestTypes)
+{
+  constexpr auto& order = enchantum::details::sorted_name_order<TestType>;
+
+  std::vector<std::string> expected(enchantum::names<TestType>.begin(), enchantum::names<TestType>.end());
+  std::sort(expected.begin(), expected.end());
+  for (std::size_t i = 0; i < order.size(); ++i)
+    CHECK(expected[i] == enchantum::names<TestType>[order[i]]);
+
+  for (std::size_t i = 0; i < enchantum::count<TestType>; ++i) {
+    const auto name = enchantum::names<TestType>[i];
+    CHECK(enchantum::details::sorted_name_index<TestType>(name) == i);
+    CHECK(enchantum::details::sorted_name_index<TestType>(std::string(name) + '_') == enchantum::count<TestType>);
+  }
+}
+
+TEMPLATE_LIST_TEST_CASE("entries_with_prefix", "[prefix]", AllEnumsTestTypes)
+{
+  const auto all = enchantum::entries_with_prefix<TestType>("");
+  CHECK(all.size() == enchantum::count<TestType>);
+
+  for (std::size_t i = 0; i < enchantum::count<TestType>; ++i) {
+    const auto name = enchantum::names<TestType>[i];
+    for (std::size_t len = 0; len <= name.size(); ++len) {
+      const auto prefix = name.substr(0, len);
+      const auto range  = enchantum::entries_with_prefix<TestType>(prefix);
+
+      const auto expected = static_cast<std::size_t>(
+        std::count_if(enchantum::names<TestType>.begin(), enchantum::names<TestType>.end(), [&](const auto s) {
+          return s.substr(0, len) == prefix;
+        }));
+      REQUIRE(range.size() == expected);
+      for (const auto [value, s] : range) {
+        CHECK(s.substr(0, len) == prefix);
+        CHECK(enchantum::to_string(value) == s);
+      }
+    }
+  }
+}
+
+TEST_CASE("entries_with_prefix Color", "[prefix]")
+{
+  constexpr auto range = enchantum::entries_with_prefix<Color>("Gr");
+  STATIC_CHECK(range.size() == 1);
+  STATIC_CHECK(range[0].first == Color::Green);
+  STATIC_CHECK((*range.begin()).second == "Green");
+  STATIC_CHECK(enchantum::entries_with_prefix<Color>("Purple").size() == 1);
+  STATIC_CHECK(enchantum::entries_with_prefix<Color>("Purples").empty());
+  STATIC_CHECK(enchantum::entries_with_prefix<Color>("Z").empty());
+}
+
+TEST_CASE("entries_with_prefix Letters", "[prefix]")
+{
+  constexpr auto range = enchantum::entries_with_prefix<Letters>("");
+  STATIC_CHECK(range.size() == 26);
+  STATIC_CHECK(range[0].first == Letters::a);
+  STATIC_CHECK(range[25].first == Letters::z);
+  STATIC_CHECK(enchantum::entries_with_prefix<Letters>("q").size() == 1);
+  STATIC_CHECK(enchantum::entries_with_prefix<Letters>("qq").empty());
+}
+
+TEST_CASE("cast falls back to sorted names", "[cast][prefix]")
+{
+  STATIC_CHECK(enchantum::count<DuplicateNames> >= ENCHANTUM_NAME_HASH_MIN_COUNT);
+  STATIC_CHECK_FALSE(enchantum::details::has_name_hash_table<DuplicateNames>);
+
+  // the first of the equal names wins like in the linear scan
+  STATIC_CHECK(enchantum::cast<DuplicateNames>("a") == First_a);
+  STATIC_CHECK(enchantum::cast<DuplicateNames>("d") == First_d);
+  STATIC_CHECK(enchantum::contains<DuplicateNames>("c"));
+  STATIC_CHECK_FALSE(enchantum::cast<DuplicateNames>("e"));
+  STATIC_CHECK_FALSE(enchantum::contains<DuplicateNames>(""));
+  STATIC_CHECK(enchantum::entries_with_prefix<DuplicateNames>("b").size() == 2);
+}
+
+namespace {
+enum class Keyword {
+  Const,
+  Constexpr,
+  Consteval,
+  Co,
+  Return,
+};
+} // namespace
+
+TEMPLATE_LIST_TEST_CASE("cast_prefix", "[cast][prefix]", AllEnumsTestTypes)
+{
+  CHECK_FALSE(enchantum::cast_prefix<TestType>(""));
+
+  for (std::size_t i = 0; i < enchantum::count<TestType>; ++i) {
+    const auto        name  = enchantum::names<TestType>[i];
+    const std::string input = std::string(name) + "|rest";
+
+    // brute force the longest name prefixing the input, the first of equal names wins
+    std::size_t expected = i;
+    for (std::size_t j = 0; j < enchantum::count<TestType>; ++j) {
+      const auto other = enchantum::names<TestType>[j];
+      if (other.size() > enchantum::names<TestType>[expected].size() && input.compare(0, other.size(), other) == 0)
+        expected = j;
+    }
+
+    const auto match = enchantum::cast_prefix<TestType>(input);
+    REQUIRE(match);
+    CHECK((*match).first == enchantum::values<TestType>[expected]);
+    CHECK((*match).second == enchantum::names<TestType>[expected].size());
+
+    CHECK_FALSE(enchantum::cast_prefix<TestType>("|" + input));
+  }
+}
+
+TEST_CASE("cast_prefix Keyword", "[cast][prefix]")
+{
+  using P = std::pair<Keyword, std::size_t>;
+  STATIC_CHECK(enchantum::cast_prefix<Keyword>("Constexpr int x") == P{Keyword::Constexpr, 9});
+  STATIC_CHECK(enchantum::cast_prefix<Keyword>("Consteval") == P{Keyword::Consteval, 9});
+  STATIC_CHECK(enchantum::cast_prefix<Keyword>("Constex") == P{Keyword::Const, 5});
+  STATIC_CHECK(enchantum::cast_prefix<Keyword>("Cons") == P{Keyword::Co, 2});
+  STATIC_CHECK(enchantum::cast_prefix<Keyword>("Return;") == P{Keyword::Return, 6});
+  STATIC_CHECK_FALSE(enchantum::cast_prefix<Keyword>("C"));
+  STATIC_CHECK_FALSE(enchantum::cast_prefix<Keyword>("return"));
+
+  STATIC_CHECK(enchantum::cast_prefix<DuplicateNames>("c,d") == std::pair<DuplicateNames, std::size_t>{First_c, 1});
+}
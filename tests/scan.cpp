@@ -0,0 +1,109 @@
+#include "test_utility.hpp"
+#include <algorithm>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <enchantum/enchantum.hpp>
+#include <enchantum/scan.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+enum class Word {
+  he,
+  she,
+  his,
+  hers,
+  s,
+};
+
+template<typename E>
+std::vector<std::pair<std::size_t, E>> naive_scan(const std::string& text)
+{
+  std::vector<std::pair<std::size_t, E>> ret;
+  for (std::size_t i = 0; i < enchantum::count<E>; ++i) {
+    const auto name = std::string(enchantum::names<E>[i]);
+    // only the first of equal names is reported
+    if (enchantum::cast<E>(name) != enchantum::values<E>[i])
+      continue;
+    for (auto pos = text.find(name); pos != std::string::npos; pos = text.find(name, pos + 1))
+      ret.emplace_back(pos, enchantum::values<E>[i]);
+  }
+  std::sort(ret.begin(), ret.end());
+  return ret;
+}
+
+} // namespace
+
+TEMPLATE_LIST_TEST_CASE("scan_names", "[scan]", AllEnumsTestTypes)
+{
+  std::string text = "no names here";
+  for (const auto name : enchantum::names<TestType>) {
+    text += ' ';
+    text += std::string(name);
+    text += std::string(name);
+    text += "__";
+  }
+  const auto expected = naive_scan<TestType>(text);
+
+  std::vector<std::pair<std::size_t, TestType>> found;
+  enchantum::scan_names<TestType>(text, [&](const std::size_t offset, const TestType value) {
+    found.emplace_back(offset, value);
+  });
+  std::sort(found.begin(), found.end());
+  CHECK(found == expected);
+
+  for (std::size_t chunk = 1; chunk < 8; ++chunk) {
+    std::vector<std::pair<std::size_t, TestType>> chunked;
+    enchantum::name_scanner<TestType>             scanner;
+    for (std::size_t i = 0; i < text.size(); i += chunk)
+      scanner(std::string_view(text).substr(i, chunk), [&](const std::size_t offset, const TestType value) {
+        chunked.emplace_back(offset, value);
+      });
+    CHECK(scanner.position() == text.size());
+    std::sort(chunked.begin(), chunked.end());
+    CHECK(chunked == expected);
+  }
+}
+
+TEST_CASE("scan_names overlapping matches", "[scan]")
+{
+  std::vector<std::pair<std::size_t, Word>> found;
+  enchantum::scan_names<Word>("ushers", [&](const std::size_t offset, const Word value) {
+    found.emplace_back(offset, value);
+  });
+  // reported in order of the end of the match, longer matches first
+  const std::vector<std::pair<std::size_t, Word>> expected{
+    {1, Word::s},
+    {1, Word::she},
+    {2, Word::he},
+    {2, Word::hers},
+    {5, Word::s},
+  };
+  CHECK(found == expected);
+
+  constexpr auto count = []() {
+    std::size_t ret = 0;
+    enchantum::scan_names<Word>("she sells his hers", [&](std::size_t, Word) { ++ret; });
+    return ret;
+  }();
+  // she he s s s his s hers he s
+  STATIC_CHECK(count == 10);
+}
+
+TEST_CASE("name_scanner across chunks", "[scan]")
+{
+  std::vector<std::pair<std::size_t, Word>> found;
+  enchantum::name_scanner<Word>             scanner;
+  const auto add = [&](const std::size_t offset, const Word value) { found.emplace_back(offset, value); };
+
+  scanner("xx h", add);
+  scanner("e", add);
+  CHECK(found == std::vector<std::pair<std::size_t, Word>>{{3, Word::he}});
+
+  scanner.reset();
+  found.clear();
+  scanner("e", add);
+  CHECK(found.empty());
+  CHECK(scanner.position() == 1);
+}
@@ -112,4 +112,29 @@ TEST_CASE("scoped::to_string_bitflag")
         "Flags::Flag0|Flags::Flag1|Flags::Flag2|Flags::Flag3|Flags::Flag4|Flags::Flag5|Flags::Flag6");
   CHECK(enchantum::scoped::to_string_bitflag(enchantum::value_ors<Flags>, ',') ==
         "Flags::Flag0,Flags::Flag1,Flags::Flag2,Flags::Flag3,Flags::Flag4,Flags::Flag5,Flags::Flag6");
-}
\ No newline at end of file
+}
+TEST_CASE("scoped::parse_bitflag")
+{
+  constexpr auto r = enchantum::scoped::parse_bitflag<FlagsWithNone>("FlagsWithNone::Flag1 , FlagsWithNone::Flag3", ",");
+  STATIC_CHECK(r.value == (FlagsWithNone::Flag1 | FlagsWithNone::Flag3));
+  STATIC_CHECK(enchantum::scoped::parse_bitflag<FlagsWithNone>("FlagsWithNone::Flag1|Flag3").position == 21);
+  STATIC_CHECK(enchantum::scoped::parse_bitflag<FlagsWithNone>("flagswithnone::FLAG2", "|", case_insensitive).position ==
+               0);
+  STATIC_CHECK(enchantum::scoped::parse_bitflag<FlagsWithNone>("FlagsWithNone::FLAG2", "|", case_insensitive).value ==
+               FlagsWithNone::Flag2);
+}
+
+TEST_CASE("scoped::to_string points to precomputed names", "[stringify]")
+{
+  STATIC_CHECK(enchantum::scoped::to_string(Direction2D::Down) == "Direction2D::Down");
+  STATIC_CHECK(enchantum::scoped::to_string(Direction2D(200)).empty());
+  STATIC_CHECK(enchantum::scoped::to_string(Direction2D::Up).data() == enchantum::scoped::to_string(Direction2D::Up).data());
+  // every scoped name is null terminated
+  STATIC_CHECK(enchantum::scoped::to_string(Direction2D::Left).data()[17] == '\0');
+
+  STATIC_CHECK(enchantum::scoped::cast<Direction2D>("Direction2D::Right") == Direction2D::Right);
+  STATIC_CHECK_FALSE(enchantum::scoped::cast<Direction2D>("Direction3D::Right").has_value());
+  STATIC_CHECK_FALSE(enchantum::scoped::cast<Direction2D>("Direction2D:Right").has_value());
+  STATIC_CHECK_FALSE(enchantum::scoped::cast<Direction2D>("Direction2D::").has_value());
+  STATIC_CHECK_FALSE(enchantum::scoped::contains<Direction2D>("Direction2D"));
+}
@@ -0,0 +1,36 @@
+#include "test_utility.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <enchantum/enchantum.hpp>
+#include <array>
+#include <string_view>
+
+namespace {
+// B is outside of the default range so it is only known through the specialized entries
+enum class Big : short {
+  A = 0,
+  B = 5000,
+};
+} // namespace
+
+template<>
+inline constexpr bool enchantum::has_specialized_entries<Big> = true;
+
+template<>
+inline constexpr auto enchantum::entries<Big> = std::array<std::pair<Big, enchantum::string_view>, 2>{
+  {{Big::A, "A"}, {Big::B, "B"}}
+};
+
+TEST_CASE("specialized entries", "[specialized_entries]")
+{
+  using namespace std::string_view_literals;
+  STATIC_CHECK(enchantum::count<Big> == 2);
+  STATIC_CHECK(equal_ranges(enchantum::values<Big>, std::array{Big::A, Big::B}));
+  STATIC_CHECK(equal_ranges(enchantum::names<Big>, std::array{"A"sv, "B"sv}));
+  STATIC_CHECK(enchantum::min<Big> == Big::A);
+  STATIC_CHECK(enchantum::max<Big> == Big::B);
+  STATIC_CHECK(enchantum::contains(Big::B));
+  STATIC_CHECK(enchantum::enum_to_index(Big::B) == 1);
+  STATIC_CHECK(enchantum::to_string(Big::B) == "B");
+  STATIC_CHECK(enchantum::cast<Big>("B") == Big::B);
+  STATIC_CHECK_FALSE(enchantum::contains(static_cast<Big>(1)));
+}
@@ -52,3 +52,39 @@ TEST_CASE("Flags enum std::format", "[stringify][std_format]")
     CHECK(std::format("{}", enchantum::value_ors<Flags>) == "Flag0|Flag1|Flag2|Flag3|Flag4|Flag5|Flag6");
   }
 }
+
+TEST_CASE("std::format enchantum options", "[stringify][std_format]")
+{
+  SECTION("scoped")
+  {
+    CHECK(std::format("{:S}", Direction2D::Up) == "Direction2D::Up");
+    CHECK(std::format("{:S}", FlagsWithNone::None) == "FlagsWithNone::None");
+    CHECK(std::format("{:S}", FlagsWithNone::Flag0 | FlagsWithNone::Flag4) == "FlagsWithNone::Flag0|FlagsWithNone::Flag4");
+    CHECK(std::format("{:S}", Direction2D(123)) == "123");
+  }
+  SECTION("underlying")
+  {
+    CHECK(std::format("{:d}", Color::Green) == std::format("{}", enchantum::to_underlying(Color::Green)));
+    CHECK(std::format("{:d}", Flags::Flag0 | Flags::Flag4) == "17");
+    CHECK(std::format("{:Sd}", Color::Green) == std::format("{}", enchantum::to_underlying(Color::Green)));
+  }
+  SECTION("separator")
+  {
+    CHECK(std::format("{:/,}", Flags::Flag0 | Flags::Flag4) == "Flag0,Flag4");
+    CHECK(std::format("{:S/ }", FlagsWithNone::Flag0 | FlagsWithNone::Flag4) == "FlagsWithNone::Flag0 FlagsWithNone::Flag4");
+    CHECK(std::format("{:/,}", Flags::Flag1) == "Flag1");
+  }
+  SECTION("standard spec")
+  {
+    CHECK(std::format("{:>7}", Color::Red) == "    Red");
+    CHECK(std::format("{:S*^21}", Direction2D::Down) == "**Direction2D::Down**");
+    CHECK(std::format("{:/,<13}", Flags::Flag0 | Flags::Flag4) == "Flag0,Flag4  ");
+    CHECK(std::format("{:.3}", Color::Purple) == "Pur");
+  }
+  SECTION("option characters as fill")
+  {
+    CHECK(std::format("{:S<6}", Color::Red) == "RedSSS");
+    CHECK(std::format("{:d>5}", Color::Red) == "ddRed");
+    CHECK(std::format("{:S/>12}", Color::Red) == "//Color::Red");
+  }
+}
@@ -511,6 +511,18 @@ type_list<Ts..., Us...> concatter_func(type_list<Ts...>, type_list<Us...>);
 template<typename A, typename B>
 using concat = decltype(::concatter_func(A{}, B{}));
 
+// `std::array::operator==` and `std::equal` are only constexpr since C++20
+template<typename A, typename B>
+constexpr bool equal_ranges(const A& a, const B& b)
+{
+  if (a.size() != b.size())
+    return false;
+  for (std::size_t i = 0; i < a.size(); ++i)
+    if (!(a[i] == b[i]))
+      return false;
+  return true;
+}
+
 using AllFlagsTestTypes = type_list<StrongFlagsNoOverloadedOperators, ImGuiFreeTypeBuilderFlags, NonContigFlagsWithNoneCStyle, FlagsWithNone, Flags>;
 using AllEnumsTestTypes = concat<
   AllFlagsTestTypes,
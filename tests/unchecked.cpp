@@ -0,0 +1,21 @@
+#include "test_utility.hpp"
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <enchantum/enchantum.hpp>
+
+TEMPLATE_LIST_TEST_CASE("unchecked variants agree with checked ones", "[to_string][enum_to_index]", AllEnumsTestTypes)
+{
+  for (std::size_t i = 0; i < enchantum::count<TestType>; ++i) {
+    const auto value = enchantum::values<TestType>[i];
+    CHECK(enchantum::enum_to_index_unchecked(value) == i);
+    CHECK(enchantum::to_string_unchecked(value) == enchantum::to_string(value));
+  }
+}
+
+TEST_CASE("unchecked variants are constexpr", "[to_string][enum_to_index]")
+{
+  STATIC_CHECK(enchantum::enum_to_index_unchecked(Color::Green) == 2);
+  STATIC_CHECK(enchantum::to_string_unchecked(Color::Red) == "Red");
+  STATIC_CHECK(enchantum::enum_to_index_unchecked(Letters::z) == 25);
+  STATIC_CHECK(enchantum::to_string_unchecked(Flags::Flag3) == "Flag3");
+}
@@ -0,0 +1,132 @@
+#include "test_utility.hpp"
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <enchantum/array.hpp>
+#include <enchantum/enchantum.hpp>
+
+namespace {
+enum class Sparse : std::int16_t {
+  A = -100,
+  B = -3,
+  C = 0,
+  D = 7,
+  E = 100,
+};
+
+enum class SparseLinear : std::int16_t {
+  A = -100,
+  B = -3,
+  C = 0,
+  D = 7,
+  E = 100,
+};
+
+template<typename E>
+std::size_t linear_index(const E e)
+{
+  for (std::size_t i = 0; i < enchantum::count<E>; ++i)
+    if (enchantum::values<E>[i] == e)
+      return i;
+  return enchantum::count<E>;
+}
+} // namespace
+
+#define SPARSE_VALUES A = -3000, B = -2999, C = -7, D = 0, E = 1, F = 64, G = 65, H = 1000, I = 2047, J = 3000
+
+#define SPARSE_ENUM_WITH(Name, Strategy)                                  \
+  enum class Name : std::int16_t { SPARSE_VALUES };                       \
+  template<>                                                              \
+  struct enchantum::enum_traits<Name> {                                   \
+    static constexpr auto min          = -3000;                           \
+    static constexpr auto max          = 3000;                            \
+    static constexpr auto index_lookup = index_lookup_strategy::Strategy; \
+  }
+
+SPARSE_ENUM_WITH(WideLinear, linear);
+SPARSE_ENUM_WITH(WideDense, dense_table);
+SPARSE_ENUM_WITH(WideBinarySearch, binary_search);
+SPARSE_ENUM_WITH(WideEytzinger, eytzinger);
+SPARSE_ENUM_WITH(WidePackedScan, packed_scan);
+
+enum class WideDefault : std::int16_t { SPARSE_VALUES };
+template<>
+struct enchantum::enum_traits<WideDefault> {
+  static constexpr auto min = -3000;
+  static constexpr auto max = 3000;
+};
+
+template<>
+struct enchantum::enum_traits<SparseLinear> {
+  static constexpr auto min          = -128;
+  static constexpr auto max          = 128;
+  static constexpr auto index_lookup = enchantum::index_lookup_strategy::linear;
+};
+
+TEMPLATE_LIST_TEST_CASE("enum_to_index and contains around every value", "[enum_to_index][value_index]", AllEnumsTestTypes)
+{
+  using T = std::underlying_type_t<TestType>;
+  for (const auto value : enchantum::values<TestType>) {
+    for (int d = -2; d <= 2; ++d) {
+      const auto v = static_cast<T>(static_cast<T>(value) + static_cast<T>(d));
+      const auto e = static_cast<TestType>(v);
+      const auto i = linear_index(e);
+      CHECK(enchantum::contains<TestType>(v) == (i != enchantum::count<TestType>));
+      if (i == enchantum::count<TestType>)
+        CHECK_FALSE(enchantum::enum_to_index(e));
+      else
+        CHECK(enchantum::enum_to_index(e) == i);
+    }
+  }
+}
+
+TEST_CASE("dense value table for sparse enums", "[enum_to_index][value_index]")
+{
+  STATIC_CHECK(enchantum::details::index_lookup_of<Sparse> == enchantum::index_lookup_strategy::dense_table);
+  STATIC_CHECK(enchantum::details::index_lookup_of<SparseLinear> == enchantum::index_lookup_strategy::linear);
+  STATIC_CHECK(enchantum::details::value_span<Sparse> == 201);
+
+  STATIC_CHECK(enchantum::enum_to_index(Sparse::A) == 0);
+  STATIC_CHECK(enchantum::enum_to_index(Sparse::E) == 4);
+  STATIC_CHECK_FALSE(enchantum::enum_to_index(static_cast<Sparse>(1)));
+  STATIC_CHECK_FALSE(enchantum::enum_to_index(static_cast<Sparse>(101)));
+  STATIC_CHECK_FALSE(enchantum::contains<Sparse>(-101));
+  STATIC_CHECK(enchantum::contains<Sparse>(7));
+  STATIC_CHECK(enchantum::to_string(Sparse::D) == "D");
+  STATIC_CHECK(enchantum::to_string(static_cast<Sparse>(8)).empty());
+
+  STATIC_CHECK(enchantum::enum_to_index(SparseLinear::D) == 3);
+  STATIC_CHECK_FALSE(enchantum::contains<SparseLinear>(1));
+
+  constexpr enchantum::array<Sparse, int> array{1, 2, 3, 4, 5};
+  STATIC_CHECK(array[Sparse::D] == 4);
+}
+
+TEMPLATE_TEST_CASE("index lookup strategies agree",
+                   "[enum_to_index][value_index]",
+                   WideLinear,
+                   WideDense,
+                   WideBinarySearch,
+                   WideEytzinger,
+                   WidePackedScan,
+                   WideDefault)
+{
+  STATIC_CHECK(enchantum::count<TestType> == 10);
+  STATIC_CHECK(enchantum::enum_to_index(TestType::A) == 0);
+  STATIC_CHECK(enchantum::enum_to_index(TestType::J) == 9);
+  STATIC_CHECK_FALSE(enchantum::enum_to_index(static_cast<TestType>(-2998)));
+
+  for (int v = -3002; v <= 3002; ++v) {
+    const auto e = static_cast<TestType>(v);
+    const auto i = linear_index(e);
+    CHECK(enchantum::contains<TestType>(static_cast<std::int16_t>(v)) == (i != enchantum::count<TestType>));
+    if (i == enchantum::count<TestType>)
+      CHECK_FALSE(enchantum::enum_to_index(e));
+    else
+      CHECK(enchantum::enum_to_index(e) == i);
+  }
+}
+
+TEST_CASE("default index lookup of wide enums", "[enum_to_index][value_index]")
+{
+  STATIC_CHECK(enchantum::details::index_lookup_of<WideDefault> == enchantum::index_lookup_strategy::eytzinger);
+}